@@ -0,0 +1,186 @@
+#include "CompactGraph.h"
+#include "Graph.h"
+#include <cfloat>
+
+using namespace std;
+
+/**************************************************************************************************
+ * Defining the CompactGraph's methods
+ **************************************************************************************************/
+
+/****************
+ * Funcao    : CompactGraph(Graph *graph, bool reverse)                                                 *
+ * Descricao : Copia as adjacências do grafo para vetores contíguos, percorrendo cada aresta uma vez     *
+ * Parametros: graph - grafo de origem                                                                  *
+ *             reverse - se verdadeiro, guarda para cada nó as arestas que chegam nele (grafo reverso)   *
+ ***************/
+CompactGraph::CompactGraph(Graph *graph, bool reverse)
+{
+    this->size = graph->getOrder();
+    this->offsets = new int[this->size + 1];
+    for (int i = 0; i <= this->size; i++)
+        this->offsets[i] = 0;
+
+    // Conta as arestas de cada nó
+    int total = 0;
+    for (Node *n = graph->getFirstNode(); n != nullptr; n = n->getNextNode())
+        for (Edge *e = n->getFirstEdge(); e != nullptr; e = e->getNextEdge())
+        {
+            int owner = reverse ? e->getTargetId() : n->getId();
+            this->offsets[owner + 1]++;
+            total++;
+        }
+    for (int i = 0; i < this->size; i++)
+        this->offsets[i + 1] += this->offsets[i];
+    this->numberEdges = total;
+
+    // Preenche os vetores de destino e peso
+    this->targets = new int[total];
+    this->edgeWeights = new float[total];
+    int *next = new int[this->size];
+    for (int i = 0; i < this->size; i++)
+        next[i] = this->offsets[i];
+    for (Node *n = graph->getFirstNode(); n != nullptr; n = n->getNextNode())
+        for (Edge *e = n->getFirstEdge(); e != nullptr; e = e->getNextEdge())
+        {
+            int owner = reverse ? e->getTargetId() : n->getId();
+            int other = reverse ? n->getId() : e->getTargetId();
+            this->targets[next[owner]] = other;
+            this->edgeWeights[next[owner]] = e->getWeight();
+            next[owner]++;
+        }
+    delete[] next;
+}
+
+// Destrutor
+CompactGraph::~CompactGraph()
+{
+    delete[] this->offsets;
+    delete[] this->targets;
+    delete[] this->edgeWeights;
+    this->offsets = nullptr;
+    this->targets = nullptr;
+    this->edgeWeights = nullptr;
+    this->size = 0;
+    this->numberEdges = 0;
+}
+
+// Getters
+int CompactGraph::getSize()
+{
+    return this->size;
+}
+int CompactGraph::getNumberEdges()
+{
+    return this->numberEdges;
+}
+int *CompactGraph::getOffsets()
+{
+    return this->offsets;
+}
+int *CompactGraph::getTargets()
+{
+    return this->targets;
+}
+float *CompactGraph::getEdgeWeights()
+{
+    return this->edgeWeights;
+}
+
+// Métodos auxiliares
+//
+
+/****************
+ * Funcao    : bool hasNegativeEdge()                           *
+ * Descricao : Verifica se alguma aresta tem peso negativo      *
+ * Parametros: Sem parâmetros.                                  *
+ * Retorno   : Retorna true se há aresta de peso negativo.      *
+ ***************/
+bool CompactGraph::hasNegativeEdge()
+{
+    for (int e = 0; e < this->numberEdges; e++)
+        if (this->edgeWeights[e] < 0)
+            return true;
+    return false;
+}
+
+/****************
+ * Funcao    : bool computePotentials(float *potentials)                                                *
+ * Descricao : Calcula os potenciais de Johnson por Bellman-Ford a partir de um nó virtual ligado a      *
+ *             todos os nós com peso 0, de modo que w(u, v) + h(u) - h(v) >= 0 para toda aresta          *
+ * Parametros: potentials - vetor de tamanho size que receberá h                                        *
+ * Retorno   : Retorna false se o grafo tem ciclo negativo.                                             *
+ ***************/
+bool CompactGraph::computePotentials(float *potentials)
+{
+    for (int i = 0; i < this->size; i++)
+        potentials[i] = 0;
+
+    for (int round = 0; round <= this->size; round++)
+    {
+        bool changed = false;
+        for (int u = 0; u < this->size; u++)
+            for (int e = this->offsets[u]; e < this->offsets[u + 1]; e++)
+            {
+                float candidate = potentials[u] + this->edgeWeights[e];
+                if (candidate < potentials[this->targets[e]])
+                {
+                    potentials[this->targets[e]] = candidate;
+                    changed = true;
+                }
+            }
+        if (!changed)
+            return true;
+    }
+    return false;
+}
+
+/****************
+ * Funcao    : void shortestPaths(int sourceId, float *distances, IndexedHeap *heap, const float *potentials)   *
+ * Descricao : Dijkstra com heap binário indexado a partir de um nó. Com potenciais, usa os pesos              *
+ *             repesados de Johnson e devolve as distâncias já corrigidas para os pesos originais.            *
+ * Parametros: sourceId - id do nó de origem                                                                 *
+ *             distances - vetor de tamanho size que receberá as distâncias (FLT_MAX se inalcançável)        *
+ *             heap - heap de trabalho com capacidade size, vazio; é devolvido vazio                         *
+ *             potentials - potenciais de computePotentials, ou nullptr se não há pesos negativos             *
+ * Retorno   : Sem retorno.                                                                                  *
+ ***************/
+void CompactGraph::shortestPaths(int sourceId, float *distances, IndexedHeap *heap, const float *potentials)
+{
+    for (int i = 0; i < this->size; i++)
+        distances[i] = FLT_MAX;
+    distances[sourceId] = 0;
+    heap->push(sourceId, 0);
+
+    while (!heap->isEmpty())
+    {
+        int u = heap->pop();
+        float distanceU = distances[u];
+        for (int e = this->offsets[u]; e < this->offsets[u + 1]; e++)
+        {
+            int v = this->targets[e];
+            float weight = this->edgeWeights[e];
+            if (potentials != nullptr)
+            {
+                weight += potentials[u] - potentials[v];
+                if (weight < 0)
+                    weight = 0;
+            }
+            float candidate = distanceU + weight;
+            if (candidate < distances[v])
+            {
+                bool reached = distances[v] != FLT_MAX;
+                distances[v] = candidate;
+                if (reached && heap->contains(v))
+                    heap->decreaseKey(v, candidate);
+                else if (!reached)
+                    heap->push(v, candidate);
+            }
+        }
+    }
+
+    if (potentials != nullptr)
+        for (int v = 0; v < this->size; v++)
+            if (distances[v] != FLT_MAX)
+                distances[v] += potentials[v] - potentials[sourceId];
+}
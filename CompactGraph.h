@@ -0,0 +1,44 @@
+/**************************************************************************************************
+ * Implementation of the TAD CompactGraph
+ **************************************************************************************************/
+
+#ifndef COMPACTGRAPH_H_INCLUDED
+#define COMPACTGRAPH_H_INCLUDED
+#include "IndexedHeap.h"
+
+using namespace std;
+
+class Graph;
+
+// Cópia somente leitura das adjacências de um Graph em vetores contíguos (CSR), indexada pelo id dos nós
+class CompactGraph
+{
+    // Atributos
+private:
+    int size;
+    int numberEdges;
+    int *offsets;
+    int *targets;
+    float *edgeWeights;
+
+public:
+    // Construtor
+    CompactGraph(Graph *graph, bool reverse);
+
+    // Destrutor
+    ~CompactGraph();
+
+    // Getters
+    int getSize();
+    int getNumberEdges();
+    int *getOffsets();
+    int *getTargets();
+    float *getEdgeWeights();
+
+    // Métodos auxiliares
+    bool hasNegativeEdge();
+    bool computePotentials(float *potentials);
+    void shortestPaths(int sourceId, float *distances, IndexedHeap *heap, const float *potentials);
+};
+
+#endif // COMPACTGRAPH_H_INCLUDED
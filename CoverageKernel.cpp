@@ -0,0 +1,211 @@
+#include "CoverageKernel.h"
+#include "Graph.h"
+#include <algorithm>
+
+using namespace std;
+
+/**************************************************************************************************
+ * Defining the CoverageKernel's methods
+ **************************************************************************************************/
+
+/****************
+ * Funcao    : CoverageKernel(Graph *graph)                                                        *
+ * Descricao : Monta a vizinhança fechada de cada nó (ele mesmo e os nós que ele cobre) como a      *
+ *             lista ordenada das suas palavras de 64 bits não nulas                               *
+ * Parametros: graph - grafo de origem                                                             *
+ ***************/
+CoverageKernel::CoverageKernel(Graph *graph)
+{
+    int nodes;
+    Node **nodeList = graph->copyNodePointersToArray(&nodes);
+    this->size = graph->getOrder();
+    this->numWords = bitsetWords(this->size);
+
+    // Cada nó da vizinhança ocupa no máximo uma palavra, o que limita o total de palavras
+    size_t maxWords = 0;
+    int maxRowSize = 1;
+    for (int i = 0; i < nodes; i++)
+    {
+        int rowSize = 1;
+        for (Edge *e = nodeList[i]->getFirstEdge(); e != nullptr; e = e->getNextEdge())
+            rowSize++;
+        maxWords += rowSize;
+        maxRowSize = max(maxRowSize, rowSize);
+    }
+    this->rowOffsets = new size_t[this->size + 1];
+    this->wordIndices = new int[maxWords > 0 ? maxWords : 1];
+    this->wordMasks = new uint64_t[maxWords > 0 ? maxWords : 1];
+
+    int *rowIds = new int[maxRowSize];
+    size_t position = 0;
+    for (int i = 0; i < this->size; i++)
+    {
+        this->rowOffsets[i] = position;
+        if (i >= nodes)
+            continue;
+        int rowSize = 0;
+        rowIds[rowSize++] = i;
+        for (Edge *e = nodeList[i]->getFirstEdge(); e != nullptr; e = e->getNextEdge())
+            rowIds[rowSize++] = e->getTargetId();
+        sort(rowIds, rowIds + rowSize);
+        for (int k = 0; k < rowSize; k++)
+        {
+            int word = rowIds[k] / 64;
+            if (position == this->rowOffsets[i] || this->wordIndices[position - 1] != word)
+            {
+                this->wordIndices[position] = word;
+                this->wordMasks[position++] = 0;
+            }
+            this->wordMasks[position - 1] |= (uint64_t)1 << (rowIds[k] % 64);
+        }
+    }
+    this->rowOffsets[this->size] = position;
+
+    // Limpa a memória
+    delete[] rowIds;
+    delete[] nodeList;
+}
+
+// Destrutor
+CoverageKernel::~CoverageKernel()
+{
+    delete[] this->rowOffsets;
+    delete[] this->wordIndices;
+    delete[] this->wordMasks;
+    this->rowOffsets = nullptr;
+    this->wordIndices = nullptr;
+    this->wordMasks = nullptr;
+    this->size = 0;
+    this->numWords = 0;
+}
+
+// Getters
+int CoverageKernel::getSize()
+{
+    return this->size;
+}
+int CoverageKernel::getNumberWords()
+{
+    return this->numWords;
+}
+int CoverageKernel::getNumberRowWords(int nodeId)
+{
+    return (int)(this->rowOffsets[nodeId + 1] - this->rowOffsets[nodeId]);
+}
+const int *CoverageKernel::getRowIndices(int nodeId)
+{
+    return this->wordIndices + this->rowOffsets[nodeId];
+}
+const uint64_t *CoverageKernel::getRowMasks(int nodeId)
+{
+    return this->wordMasks + this->rowOffsets[nodeId];
+}
+
+// Métodos de manipulação
+//
+
+/****************
+ * Funcao    : uint64_t *createUncoveredSet()                                   *
+ * Descricao : Aloca um conjunto de nós descobertos com todos os nós do grafo    *
+ * Parametros: Sem parâmetros.                                                  *
+ * Retorno   : Conjunto alocado, a ser liberado com freeBitset.                  *
+ ***************/
+uint64_t *CoverageKernel::createUncoveredSet()
+{
+    uint64_t *uncovered = allocBitset(this->numWords);
+    this->resetUncoveredSet(uncovered);
+    return uncovered;
+}
+
+/****************
+ * Funcao    : void resetUncoveredSet(uint64_t *uncovered)                      *
+ * Descricao : Marca novamente todos os nós como descobertos                    *
+ * Parametros: uncovered - conjunto de nós descobertos                          *
+ * Retorno   : Sem retorno.                                                     *
+ ***************/
+void CoverageKernel::resetUncoveredSet(uint64_t *uncovered)
+{
+    fillBitset(uncovered, this->size, this->numWords);
+}
+
+/****************
+ * Funcao    : void loadNeighborhood(int nodeId, uint64_t *row)                             *
+ * Descricao : Liga em um conjunto denso os bits da vizinhança fechada de um nó              *
+ * Parametros: nodeId - id do nó                                                            *
+ *             row - conjunto com getNumberWords() palavras                                  *
+ * Retorno   : Sem retorno.                                                                 *
+ ***************/
+void CoverageKernel::loadNeighborhood(int nodeId, uint64_t *row)
+{
+    for (size_t k = this->rowOffsets[nodeId]; k < this->rowOffsets[nodeId + 1]; k++)
+        row[this->wordIndices[k]] |= this->wordMasks[k];
+}
+
+/****************
+ * Funcao    : int gain(const uint64_t *uncovered, int nodeId)                          *
+ * Descricao : Conta os nós descobertos na vizinhança fechada de um nó (AND + popcount   *
+ *             sobre as palavras da linha)                                               *
+ * Parametros: uncovered - conjunto de nós descobertos                                  *
+ *             nodeId - id do nó avaliado                                               *
+ * Retorno   : Quantidade de nós que o nó cobriria.                                     *
+ ***************/
+int CoverageKernel::gain(const uint64_t *uncovered, int nodeId)
+{
+    int count = 0;
+    for (size_t k = this->rowOffsets[nodeId]; k < this->rowOffsets[nodeId + 1]; k++)
+        count += __builtin_popcountll(uncovered[this->wordIndices[k]] & this->wordMasks[k]);
+    return count;
+}
+
+/****************
+ * Funcao    : int cover(uint64_t *uncovered, int nodeId)                               *
+ * Descricao : Remove dos descobertos a vizinhança fechada de um nó escolhido            *
+ * Parametros: uncovered - conjunto de nós descobertos                                  *
+ *             nodeId - id do nó escolhido                                              *
+ * Retorno   : Quantidade de nós cobertos pela escolha.                                 *
+ ***************/
+int CoverageKernel::cover(uint64_t *uncovered, int nodeId)
+{
+    int count = 0;
+    for (size_t k = this->rowOffsets[nodeId]; k < this->rowOffsets[nodeId + 1]; k++)
+    {
+        uint64_t *word = uncovered + this->wordIndices[k];
+        count += __builtin_popcountll(*word & this->wordMasks[k]);
+        *word &= ~this->wordMasks[k];
+    }
+    return count;
+}
+
+/****************
+ * Funcao    : int cover(uint64_t *uncovered, int nodeId, int *coveredIds)              *
+ * Descricao : Remove dos descobertos a vizinhança fechada de um nó escolhido, listando  *
+ *             os nós que deixaram de estar descobertos, em ordem crescente de id       *
+ * Parametros: uncovered - conjunto de nós descobertos                                  *
+ *             nodeId - id do nó escolhido                                              *
+ *             coveredIds - vetor que recebe os ids dos nós cobertos pela escolha       *
+ * Retorno   : Quantidade de nós cobertos pela escolha.                                 *
+ ***************/
+int CoverageKernel::cover(uint64_t *uncovered, int nodeId, int *coveredIds)
+{
+    int count = 0;
+    for (size_t k = this->rowOffsets[nodeId]; k < this->rowOffsets[nodeId + 1]; k++)
+    {
+        uint64_t *word = uncovered + this->wordIndices[k];
+        for (uint64_t bits = *word & this->wordMasks[k]; bits != 0; bits &= bits - 1)
+            coveredIds[count++] = this->wordIndices[k] * 64 + __builtin_ctzll(bits);
+        *word &= ~this->wordMasks[k];
+    }
+    return count;
+}
+
+/****************
+ * Funcao    : bool isCovered(const uint64_t *uncovered, int nodeId)    *
+ * Descricao : Verifica se um nó já está coberto                        *
+ * Parametros: uncovered - conjunto de nós descobertos                  *
+ *             nodeId - id do nó                                        *
+ * Retorno   : Retorna true se o nó está coberto.                       *
+ ***************/
+bool CoverageKernel::isCovered(const uint64_t *uncovered, int nodeId)
+{
+    return (uncovered[nodeId / 64] & ((uint64_t)1 << (nodeId % 64))) == 0;
+}
@@ -0,0 +1,53 @@
+/**************************************************************************************************
+ * Implementation of the TAD CoverageKernel
+ **************************************************************************************************/
+
+#ifndef COVERAGEKERNEL_H_INCLUDED
+#define COVERAGEKERNEL_H_INCLUDED
+#include "bitset/bitset.h"
+#include <cstddef>
+
+using namespace std;
+
+class Graph;
+
+// Vizinhanças fechadas dos nós de um Graph como conjuntos de bits esparsos, para calcular ganhos e
+// cobrir nós do conjunto dominante com operações sobre palavras. Cada linha guarda só as palavras de 64
+// bits não nulas da vizinhança (índice e máscara), então a memória é O(n + m) e um ganho custa O(grau),
+// mesmo em grafos grandes. O conjunto de nós descobertos é denso e fica com o chamador, de modo que
+// várias construções podem compartilhar o mesmo kernel.
+class CoverageKernel
+{
+    // Atributos
+private:
+    int size;
+    int numWords;
+    size_t *rowOffsets;
+    int *wordIndices;
+    uint64_t *wordMasks;
+
+public:
+    // Construtor
+    CoverageKernel(Graph *graph);
+
+    // Destrutor
+    ~CoverageKernel();
+
+    // Getters
+    int getSize();
+    int getNumberWords();
+    int getNumberRowWords(int nodeId);
+    const int *getRowIndices(int nodeId);
+    const uint64_t *getRowMasks(int nodeId);
+
+    // Métodos de manipulação
+    uint64_t *createUncoveredSet();
+    void resetUncoveredSet(uint64_t *uncovered);
+    void loadNeighborhood(int nodeId, uint64_t *row);
+    int gain(const uint64_t *uncovered, int nodeId);
+    int cover(uint64_t *uncovered, int nodeId);
+    int cover(uint64_t *uncovered, int nodeId, int *coveredIds);
+    bool isCovered(const uint64_t *uncovered, int nodeId);
+};
+
+#endif // COVERAGEKERNEL_H_INCLUDED
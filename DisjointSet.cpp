@@ -0,0 +1,88 @@
+#include "DisjointSet.h"
+
+using namespace std;
+
+/**************************************************************************************************
+ * Defining the DisjointSet's methods
+ **************************************************************************************************/
+
+// Construtor
+DisjointSet::DisjointSet(int size)
+{
+    this->size = size;
+    this->numberSets = size;
+    this->parents = new int[size];
+    this->setSizes = new int[size];
+    for (int i = 0; i < size; i++)
+    {
+        this->parents[i] = i;
+        this->setSizes[i] = 1;
+    }
+}
+
+// Destrutor
+DisjointSet::~DisjointSet()
+{
+    delete[] this->parents;
+    delete[] this->setSizes;
+    this->parents = nullptr;
+    this->setSizes = nullptr;
+    this->size = 0;
+    this->numberSets = 0;
+}
+
+// Getters
+int DisjointSet::getSize()
+{
+    return this->size;
+}
+int DisjointSet::getNumberSets()
+{
+    return this->numberSets;
+}
+
+// Métodos de manipulação
+//
+
+/****************
+ * Funcao    : int find(int element)                                        *
+ * Descricao : Encontra o representante do conjunto de um elemento,         *
+ *             encurtando o caminho pela metade a cada consulta             *
+ * Parametros: element - elemento consultado                                *
+ * Retorno   : Retorna o representante do conjunto.                         *
+ ***************/
+int DisjointSet::find(int element)
+{
+    while (this->parents[element] != element)
+    {
+        this->parents[element] = this->parents[this->parents[element]];
+        element = this->parents[element];
+    }
+    return element;
+}
+
+/****************
+ * Funcao    : bool unite(int firstElement, int secondElement)              *
+ * Descricao : Une os conjuntos de dois elementos, pendurando o menor        *
+ *             conjunto no maior                                            *
+ * Parametros: firstElement - elemento do primeiro conjunto                 *
+ *             secondElement - elemento do segundo conjunto                 *
+ * Retorno   : Retorna false se os elementos já estavam no mesmo conjunto.  *
+ ***************/
+bool DisjointSet::unite(int firstElement, int secondElement)
+{
+    int firstRoot = this->find(firstElement);
+    int secondRoot = this->find(secondElement);
+    if (firstRoot == secondRoot)
+        return false;
+    if (this->setSizes[firstRoot] < this->setSizes[secondRoot])
+    {
+        int aux = firstRoot;
+        firstRoot = secondRoot;
+        secondRoot = aux;
+    }
+    this->parents[secondRoot] = firstRoot;
+    this->setSizes[firstRoot] += this->setSizes[secondRoot];
+    this->numberSets--;
+    return true;
+}
@@ -0,0 +1,36 @@
+/**************************************************************************************************
+ * Implementation of the TAD DisjointSet
+ **************************************************************************************************/
+
+#ifndef DISJOINTSET_H_INCLUDED
+#define DISJOINTSET_H_INCLUDED
+
+using namespace std;
+
+// Estrutura union-find sobre os elementos 0..size-1, com compressão de caminho e união por tamanho
+class DisjointSet
+{
+    // Atributos
+private:
+    int size;
+    int numberSets;
+    int *parents;
+    int *setSizes;
+
+public:
+    // Construtor
+    DisjointSet(int size);
+
+    // Destrutor
+    ~DisjointSet();
+
+    // Getters
+    int getSize();
+    int getNumberSets();
+
+    // Métodos de manipulação
+    int find(int element);
+    bool unite(int firstElement, int secondElement);
+};
+
+#endif // DISJOINTSET_H_INCLUDED
@@ -0,0 +1,250 @@
+#include "DiskDistanceMatrix.h"
+#include "matrix/matrix.h"
+#include <iostream>
+#include <cfloat>
+#include <cmath>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+using namespace std;
+
+/**************************************************************************************************
+ * Defining the DiskDistanceMatrix's methods
+ **************************************************************************************************/
+
+/****************
+ * Funcao    : DiskDistanceMatrix(int size, string path, size_t memoryBudget)                                 *
+ * Descricao : Cria e mapeia o arquivo da matriz. O lado dos tiles é o maior múltiplo de MATRIX_BLOCK tal     *
+ *             que três tiles (alvo e os dois operandos) caibam no orçamento de memória; se a matriz inteira  *
+ *             couber, usa um único tile.                                                                     *
+ * Parametros: size - quantidade de nós                                                                       *
+ *             path - caminho do arquivo de apoio, criado (ou truncado) aqui e removido no destrutor          *
+ *             memoryBudget - memória, em bytes, que a computação pode manter residente                       *
+ ***************/
+DiskDistanceMatrix::DiskDistanceMatrix(int size, string path, size_t memoryBudget)
+{
+    this->size = size;
+    this->path = path;
+    this->data = nullptr;
+
+    int padded = ((size + MATRIX_BLOCK - 1) / MATRIX_BLOCK) * MATRIX_BLOCK;
+    if (padded == 0)
+        padded = MATRIX_BLOCK;
+    int tileSize = (int)(sqrt((double)memoryBudget / (3 * sizeof(float))) / MATRIX_BLOCK) * MATRIX_BLOCK;
+    if (tileSize < MATRIX_BLOCK)
+        tileSize = MATRIX_BLOCK;
+    if (tileSize > padded)
+        tileSize = padded;
+    this->tileSize = tileSize;
+    this->tilesPerSide = (size + tileSize - 1) / tileSize;
+    if (this->tilesPerSide == 0)
+        this->tilesPerSide = 1;
+    this->bytes = (size_t)this->tilesPerSide * this->tilesPerSide * tileSize * tileSize * sizeof(float);
+
+    this->fileDescriptor = open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0600);
+    if (this->fileDescriptor < 0)
+        return;
+    if (ftruncate(this->fileDescriptor, this->bytes) != 0)
+        return;
+    void *mapped = mmap(nullptr, this->bytes, PROT_READ | PROT_WRITE, MAP_SHARED, this->fileDescriptor, 0);
+    if (mapped != MAP_FAILED)
+        this->data = (float *)mapped;
+}
+
+// Destrutor
+DiskDistanceMatrix::~DiskDistanceMatrix()
+{
+    if (this->data != nullptr)
+        munmap(this->data, this->bytes);
+    if (this->fileDescriptor >= 0)
+    {
+        close(this->fileDescriptor);
+        unlink(this->path.c_str());
+    }
+    this->data = nullptr;
+    this->fileDescriptor = -1;
+    this->size = 0;
+    this->bytes = 0;
+}
+
+// Getters
+int DiskDistanceMatrix::getSize()
+{
+    return this->size;
+}
+int DiskDistanceMatrix::getTileSize()
+{
+    return this->tileSize;
+}
+
+// Métodos de consulta
+//
+
+/****************
+ * Funcao    : float getDistance(int sourceId, int targetId)                    *
+ * Descricao : Consulta o caminho mínimo entre dois nós                         *
+ * Parametros: sourceId - id do nó de origem                                    *
+ *             targetId - id do nó de destino                                   *
+ * Retorno   : Retorna o custo do caminho mínimo, ou FLT_MAX se inalcançável.   *
+ ***************/
+float DiskDistanceMatrix::getDistance(int sourceId, int targetId)
+{
+    float *tile = this->getTile(sourceId / this->tileSize, targetId / this->tileSize);
+    return tile[(size_t)(sourceId % this->tileSize) * this->tileSize + targetId % this->tileSize];
+}
+
+/****************
+ * Funcao    : void getRow(int sourceId, float *row)                                    *
+ * Descricao : Copia os caminhos mínimos de um nó para todos os demais                  *
+ * Parametros: sourceId - id do nó de origem                                            *
+ *             row - vetor de tamanho size que receberá as distâncias                   *
+ * Retorno   : Sem retorno.                                                             *
+ ***************/
+void DiskDistanceMatrix::getRow(int sourceId, float *row)
+{
+    int tileRow = sourceId / this->tileSize;
+    size_t offset = (size_t)(sourceId % this->tileSize) * this->tileSize;
+    for (int j = 0; j < this->size; j++)
+    {
+        float *tile = this->getTile(tileRow, j / this->tileSize);
+        row[j] = tile[offset + j % this->tileSize];
+    }
+}
+
+// Métodos auxiliares
+//
+
+bool DiskDistanceMatrix::isOpen()
+{
+    return this->data != nullptr;
+}
+
+/****************
+ * Funcao    : bool compute(CompactGraph *graph, int numThreads)                                           *
+ * Descricao : Preenche o arquivo com as distâncias iniciais e executa o Floyd-Warshall em blocos no nível *
+ *             dos tiles: para cada tile pivô K, fecha (K, K) em memória, relaxa a linha e a coluna K e,   *
+ *             por fim, cada tile (I, J) por (I, K) ⊗ (K, J). Só três tiles ficam residentes por vez; os   *
+ *             demais são devolvidos ao arquivo.                                                           *
+ * Parametros: graph - adjacências do grafo                                                                *
+ *             numThreads - quantidade de threads usada dentro de cada tile                                *
+ * Retorno   : Retorna false se o grafo tem ciclo negativo.                                                *
+ ***************/
+bool DiskDistanceMatrix::compute(CompactGraph *graph, int numThreads)
+{
+    int tiles = this->tilesPerSide;
+    int side = this->tileSize;
+
+    for (int I = 0; I < tiles; I++)
+        for (int J = 0; J < tiles; J++)
+            this->initializeTile(graph, I, J);
+
+    for (int K = 0; K < tiles; K++)
+    {
+        // Fase 1: tile pivô
+        float *pivot = this->getTile(K, K);
+        floydWarshallBlocked(&pivot, side, side, numThreads);
+
+        // Fase 2: tiles da linha e da coluna do pivô
+        for (int b = 0; b < tiles; b++)
+        {
+            if (b == K)
+                continue;
+            float *rowTile = this->getTile(K, b);
+            minPlusMultiply(rowTile, pivot, rowTile, side, side, numThreads);
+            this->releaseTile(rowTile);
+            float *columnTile = this->getTile(b, K);
+            minPlusMultiply(columnTile, columnTile, pivot, side, side, numThreads);
+            this->releaseTile(columnTile);
+        }
+        this->releaseTile(pivot);
+
+        // Fase 3: demais tiles
+        for (int I = 0; I < tiles; I++)
+        {
+            if (I == K)
+                continue;
+            float *left = this->getTile(I, K);
+            for (int J = 0; J < tiles; J++)
+            {
+                if (J == K)
+                    continue;
+                float *target = this->getTile(I, J);
+                float *right = this->getTile(K, J);
+                minPlusMultiply(target, left, right, side, side, numThreads);
+                this->releaseTile(target);
+                this->releaseTile(right);
+            }
+            this->releaseTile(left);
+        }
+    }
+
+    for (int i = 0; i < this->size; i++)
+        if (this->getDistance(i, i) < 0)
+            return false;
+    return true;
+}
+
+/****************
+ * Funcao    : float *getTile(int tileRow, int tileColumn)                  *
+ * Descricao : Localiza um tile no arquivo mapeado                          *
+ * Parametros: tileRow - linha do tile                                      *
+ *             tileColumn - coluna do tile                                  *
+ * Retorno   : Ponteiro para o primeiro elemento do tile.                   *
+ ***************/
+float *DiskDistanceMatrix::getTile(int tileRow, int tileColumn)
+{
+    size_t tileFloats = (size_t)this->tileSize * this->tileSize;
+    return this->data + ((size_t)tileRow * this->tilesPerSide + tileColumn) * tileFloats;
+}
+
+/****************
+ * Funcao    : void releaseTile(float *tile)                                                    *
+ * Descricao : Agenda a gravação de um tile no arquivo e retira suas páginas da memória do       *
+ *             processo, mantendo limitado o conjunto residente                                 *
+ * Parametros: tile - ponteiro obtido por getTile                                               *
+ * Retorno   : Sem retorno.                                                                     *
+ ***************/
+void DiskDistanceMatrix::releaseTile(float *tile)
+{
+    size_t tileBytes = (size_t)this->tileSize * this->tileSize * sizeof(float);
+    msync(tile, tileBytes, MS_ASYNC);
+    madvise(tile, tileBytes, MADV_DONTNEED);
+}
+
+/****************
+ * Funcao    : void initializeTile(CompactGraph *graph, int tileRow, int tileColumn)                    *
+ * Descricao : Escreve em um tile as distâncias sem intermediários: 0 na diagonal, o peso das arestas   *
+ *             cujas pontas caem no tile e FLT_MAX nas demais posições (inclusive no preenchimento)     *
+ * Parametros: graph - adjacências do grafo                                                             *
+ *             tileRow - linha do tile                                                                  *
+ *             tileColumn - coluna do tile                                                              *
+ * Retorno   : Sem retorno.                                                                             *
+ ***************/
+void DiskDistanceMatrix::initializeTile(CompactGraph *graph, int tileRow, int tileColumn)
+{
+    int side = this->tileSize;
+    float *tile = this->getTile(tileRow, tileColumn);
+    for (size_t i = 0; i < (size_t)side * side; i++)
+        tile[i] = FLT_MAX;
+    if (tileRow == tileColumn)
+        for (int i = 0; i < side; i++)
+            tile[(size_t)i * side + i] = 0;
+
+    int *offsets = graph->getOffsets();
+    int *targets = graph->getTargets();
+    float *edgeWeights = graph->getEdgeWeights();
+    int firstSource = tileRow * side;
+    int firstTarget = tileColumn * side;
+    for (int u = firstSource; u < firstSource + side && u < this->size; u++)
+        for (int e = offsets[u]; e < offsets[u + 1]; e++)
+        {
+            int v = targets[e];
+            if (v == u || v < firstTarget || v >= firstTarget + side)
+                continue;
+            float *cell = tile + (size_t)(u - firstSource) * side + (v - firstTarget);
+            if (edgeWeights[e] < *cell)
+                *cell = edgeWeights[e];
+        }
+    this->releaseTile(tile);
+}
@@ -0,0 +1,53 @@
+/**************************************************************************************************
+ * Implementation of the TAD DiskDistanceMatrix
+ **************************************************************************************************/
+
+#ifndef DISKDISTANCEMATRIX_H_INCLUDED
+#define DISKDISTANCEMATRIX_H_INCLUDED
+#include "CompactGraph.h"
+#include <string>
+#include <cstddef>
+
+using namespace std;
+
+// Matriz de caminhos mínimos mantida em um arquivo mapeado em memória, particionada em blocos (tiles)
+// quadrados gravados de forma contígua, para grafos cuja matriz completa não cabe na memória
+class DiskDistanceMatrix
+{
+    // Atributos
+private:
+    int size;
+    int tileSize;
+    int tilesPerSide;
+    string path;
+    int fileDescriptor;
+    float *data;
+    size_t bytes;
+
+public:
+    // Construtor
+    DiskDistanceMatrix(int size, string path, size_t memoryBudget);
+
+    // Destrutor
+    ~DiskDistanceMatrix();
+
+    // Getters
+    int getSize();
+    int getTileSize();
+
+    // Métodos de consulta
+    float getDistance(int sourceId, int targetId);
+    void getRow(int sourceId, float *row);
+
+    // Métodos auxiliares
+    bool isOpen();
+    bool compute(CompactGraph *graph, int numThreads);
+
+private:
+    // Métodos auxiliares
+    float *getTile(int tileRow, int tileColumn);
+    void releaseTile(float *tile);
+    void initializeTile(CompactGraph *graph, int tileRow, int tileColumn);
+};
+
+#endif // DISKDISTANCEMATRIX_H_INCLUDED
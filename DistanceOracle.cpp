@@ -0,0 +1,223 @@
+#include "DistanceOracle.h"
+#include "Graph.h"
+#include <cfloat>
+
+using namespace std;
+
+/**************************************************************************************************
+ * Defining the DistanceOracle's methods
+ **************************************************************************************************/
+
+/****************
+ * Funcao    : DistanceOracle(Graph *graph, size_t memoryBudget)                                           *
+ * Descricao : Prepara o oráculo sem calcular nenhuma distância. Com arestas negativas, calcula uma vez os  *
+ *             potenciais de Johnson para que cada linha seja um Dijkstra.                                 *
+ * Parametros: graph - grafo consultado; alterações posteriores no grafo não são refletidas                *
+ *             memoryBudget - memória, em bytes, destinada às linhas em cache (ao menos uma linha)          *
+ ***************/
+DistanceOracle::DistanceOracle(Graph *graph, size_t memoryBudget)
+{
+    this->compactGraph = new CompactGraph(graph, false);
+    this->size = this->compactGraph->getSize();
+    this->directed = graph->getDirected();
+    this->heap = new IndexedHeap(this->size);
+    this->valid = true;
+    this->potentials = nullptr;
+    if (this->compactGraph->hasNegativeEdge())
+    {
+        this->potentials = new float[this->size];
+        this->valid = this->compactGraph->computePotentials(this->potentials);
+    }
+
+    // Com ciclo negativo, nenhuma linha é calculada: todas as consultas recebem a mesma linha de -FLT_MAX
+    this->undefinedRow = nullptr;
+    if (!this->valid)
+    {
+        this->undefinedRow = new float[this->size > 0 ? this->size : 1];
+        for (int i = 0; i < this->size; i++)
+            this->undefinedRow[i] = -FLT_MAX;
+    }
+
+    size_t rowBytes = (size_t)(this->size > 0 ? this->size : 1) * sizeof(float);
+    size_t capacity = memoryBudget / rowBytes;
+    if (capacity < 1)
+        capacity = 1;
+    if (capacity > (size_t)this->size)
+        capacity = this->size > 0 ? this->size : 1;
+    this->capacity = (int)capacity;
+    this->usedSlots = 0;
+
+    // As linhas são alocadas apenas quando um slot é usado pela primeira vez
+    this->rows = new float *[this->capacity];
+    this->sourceOfSlot = new int[this->capacity];
+    this->previousSlot = new int[this->capacity];
+    this->nextSlot = new int[this->capacity];
+    for (int i = 0; i < this->capacity; i++)
+        this->rows[i] = nullptr;
+    this->slotOfSource = new int[this->size];
+    for (int i = 0; i < this->size; i++)
+        this->slotOfSource[i] = -1;
+    this->mostRecent = -1;
+    this->leastRecent = -1;
+    this->hits = 0;
+    this->misses = 0;
+}
+
+// Destrutor
+DistanceOracle::~DistanceOracle()
+{
+    for (int i = 0; i < this->usedSlots; i++)
+        delete[] this->rows[i];
+    delete[] this->rows;
+    delete[] this->sourceOfSlot;
+    delete[] this->previousSlot;
+    delete[] this->nextSlot;
+    delete[] this->slotOfSource;
+    delete[] this->potentials;
+    delete[] this->undefinedRow;
+    delete this->heap;
+    delete this->compactGraph;
+    this->rows = nullptr;
+    this->undefinedRow = nullptr;
+    this->compactGraph = nullptr;
+    this->heap = nullptr;
+    this->size = 0;
+    this->capacity = 0;
+}
+
+// Getters
+int DistanceOracle::getSize()
+{
+    return this->size;
+}
+int DistanceOracle::getCapacity()
+{
+    return this->capacity;
+}
+long DistanceOracle::getHits()
+{
+    return this->hits;
+}
+long DistanceOracle::getMisses()
+{
+    return this->misses;
+}
+
+// Métodos de consulta
+//
+
+/****************
+ * Funcao    : float getDistance(int sourceId, int targetId)                                           *
+ * Descricao : Consulta o caminho mínimo entre dois nós. Em grafos não direcionados, aproveita a linha  *
+ *             do destino se ela já estiver em cache.                                                  *
+ * Parametros: sourceId - id do nó de origem                                                           *
+ *             targetId - id do nó de destino                                                          *
+ * Retorno   : Retorna o custo do caminho mínimo, FLT_MAX se inalcançável, ou -FLT_MAX se o grafo tem  *
+ *             ciclo negativo (distância indefinida).                                                  *
+ ***************/
+float DistanceOracle::getDistance(int sourceId, int targetId)
+{
+    if (!this->valid)
+        return -FLT_MAX;
+    if (!this->directed && this->slotOfSource[sourceId] < 0 && this->slotOfSource[targetId] >= 0)
+        return this->getRow(targetId)[sourceId];
+    return this->getRow(sourceId)[targetId];
+}
+
+/****************
+ * Funcao    : float *getRow(int sourceId)                                                              *
+ * Descricao : Consulta os caminhos mínimos de um nó para todos os demais, calculando-os por Dijkstra    *
+ *             se a linha não estiver em cache                                                          *
+ * Parametros: sourceId - id do nó de origem                                                            *
+ * Retorno   : Vetor de tamanho size pertencente ao oráculo, válido até a próxima consulta. Se o grafo tem *
+ *             ciclo negativo, a linha é preenchida com -FLT_MAX (distâncias indefinidas).              *
+ ***************/
+float *DistanceOracle::getRow(int sourceId)
+{
+    // Os potenciais de um grafo com ciclo negativo não valem, e o Dijkstra daria distâncias finitas erradas
+    if (!this->valid)
+        return this->undefinedRow;
+
+    int slot = this->slotOfSource[sourceId];
+    if (slot >= 0)
+    {
+        this->hits++;
+        if (slot != this->mostRecent)
+        {
+            this->detachSlot(slot);
+            this->attachSlotAsMostRecent(slot);
+        }
+        return this->rows[slot];
+    }
+
+    this->misses++;
+    slot = this->acquireSlot(sourceId);
+    this->compactGraph->shortestPaths(sourceId, this->rows[slot], this->heap, this->potentials);
+    return this->rows[slot];
+}
+
+// Métodos auxiliares
+//
+
+/****************
+ * Funcao    : bool isValid()                                                          *
+ * Descricao : Verifica se as distâncias são definidas, ou seja, se não há ciclo negativo *
+ * Parametros: Sem parâmetros.                                                         *
+ * Retorno   : Retorna false se o grafo tem ciclo negativo.                            *
+ ***************/
+bool DistanceOracle::isValid()
+{
+    return this->valid;
+}
+
+/****************
+ * Funcao    : int acquireSlot(int sourceId)                                                    *
+ * Descricao : Obtém um slot para a linha de um nó: um slot ainda não usado, se houver, ou o     *
+ *             usado há mais tempo, que é removido da cache                                     *
+ * Parametros: sourceId - id do nó de origem da nova linha                                      *
+ * Retorno   : Índice do slot, já marcado como o mais recente.                                  *
+ ***************/
+int DistanceOracle::acquireSlot(int sourceId)
+{
+    int slot;
+    if (this->usedSlots < this->capacity)
+    {
+        slot = this->usedSlots++;
+        this->rows[slot] = new float[this->size];
+    }
+    else
+    {
+        slot = this->leastRecent;
+        this->detachSlot(slot);
+        this->slotOfSource[this->sourceOfSlot[slot]] = -1;
+    }
+    this->sourceOfSlot[slot] = sourceId;
+    this->slotOfSource[sourceId] = slot;
+    this->attachSlotAsMostRecent(slot);
+    return slot;
+}
+
+void DistanceOracle::detachSlot(int slot)
+{
+    int previous = this->previousSlot[slot];
+    int next = this->nextSlot[slot];
+    if (previous >= 0)
+        this->nextSlot[previous] = next;
+    else
+        this->mostRecent = next;
+    if (next >= 0)
+        this->previousSlot[next] = previous;
+    else
+        this->leastRecent = previous;
+}
+
+void DistanceOracle::attachSlotAsMostRecent(int slot)
+{
+    this->previousSlot[slot] = -1;
+    this->nextSlot[slot] = this->mostRecent;
+    if (this->mostRecent >= 0)
+        this->previousSlot[this->mostRecent] = slot;
+    this->mostRecent = slot;
+    if (this->leastRecent < 0)
+        this->leastRecent = slot;
+}
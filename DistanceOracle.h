@@ -0,0 +1,69 @@
+/**************************************************************************************************
+ * Implementation of the TAD DistanceOracle
+ **************************************************************************************************/
+
+#ifndef DISTANCEORACLE_H_INCLUDED
+#define DISTANCEORACLE_H_INCLUDED
+#include "CompactGraph.h"
+#include "IndexedHeap.h"
+#include <cstddef>
+
+using namespace std;
+
+class Graph;
+
+// Oráculo de distâncias: calcula as linhas de caminhos mínimos sob demanda, no primeiro acesso, e as
+// mantém em uma cache LRU limitada por um orçamento de memória. Se o grafo tem ciclo negativo (isValid()
+// devolve false), as distâncias são indefinidas: getDistance devolve -FLT_MAX e getRow, uma linha toda em
+// -FLT_MAX, sem calcular caminhos. Não é seguro para uso entre threads.
+class DistanceOracle
+{
+    // Atributos
+private:
+    int size;
+    bool directed;
+    bool valid;
+    CompactGraph *compactGraph;
+    IndexedHeap *heap;
+    float *potentials;
+    float *undefinedRow;
+    int capacity;
+    int usedSlots;
+    float **rows;
+    int *slotOfSource;
+    int *sourceOfSlot;
+    int *previousSlot;
+    int *nextSlot;
+    int mostRecent;
+    int leastRecent;
+    long hits;
+    long misses;
+
+public:
+    // Construtor
+    DistanceOracle(Graph *graph, size_t memoryBudget);
+
+    // Destrutor
+    ~DistanceOracle();
+
+    // Getters
+    int getSize();
+    int getCapacity();
+    long getHits();
+    long getMisses();
+
+    // Métodos de consulta
+    float getDistance(int sourceId, int targetId);
+    float *getRow(int sourceId);
+
+    // Métodos auxiliares
+    bool isValid();
+
+private:
+    // Métodos auxiliares
+    int acquireSlot(int sourceId);
+    void detachSlot(int slot);
+    void attachSlotAsMostRecent(int slot);
+};
+
+#endif // DISTANCEORACLE_H_INCLUDED
@@ -0,0 +1,204 @@
+#include "DominatingSetLowerBound.h"
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
+using namespace std;
+
+// Varreduras seguidas sem melhora antes de reduzir o passo do subgradiente
+static const int STEP_PATIENCE = 5;
+
+/**************************************************************************************************
+ * Defining the DominatingSetLowerBound's methods
+ **************************************************************************************************/
+
+/****************
+ * Funcao    : DominatingSetLowerBound(CompactGraph *forwardGraph, CompactGraph *reverseGraph, const float *weights)*
+ * Descricao : Prepara os multiplicadores e custos reduzidos sobre adjacências e pesos compartilhados              *
+ * Parametros: forwardGraph - adjacências de saída (nós cobertos por cada nó)                                     *
+ *             reverseGraph - adjacências de entrada (nós que cobrem cada nó); em grafos não direcionados         *
+ *                            pode ser o próprio forwardGraph                                                     *
+ *             weights - peso de cada nó, indexado pelo id                                                        *
+ ***************/
+DominatingSetLowerBound::DominatingSetLowerBound(CompactGraph *forwardGraph, CompactGraph *reverseGraph, const float *weights)
+{
+    this->size = forwardGraph->getSize();
+    this->forwardGraph = forwardGraph;
+    this->reverseGraph = reverseGraph;
+    this->weights = weights;
+    this->integralWeights = true;
+    for (int i = 0; i < this->size; i++)
+        if (weights[i] != floorf(weights[i]))
+            this->integralWeights = false;
+    this->multipliers = new double[this->size];
+    this->reducedCosts = new double[this->size];
+    this->subgradients = new int[this->size];
+    this->upperBound = FLT_MAX;
+    this->bound = 0;
+}
+
+// Destrutor
+DominatingSetLowerBound::~DominatingSetLowerBound()
+{
+    delete[] this->multipliers;
+    delete[] this->reducedCosts;
+    delete[] this->subgradients;
+    this->multipliers = this->reducedCosts = nullptr;
+    this->subgradients = nullptr;
+    this->forwardGraph = this->reverseGraph = nullptr;
+    this->weights = nullptr;
+    this->size = 0;
+}
+
+// Getters
+int DominatingSetLowerBound::getSize()
+{
+    return this->size;
+}
+float DominatingSetLowerBound::getBound()
+{
+    return this->bound;
+}
+float DominatingSetLowerBound::getUpperBound()
+{
+    return this->upperBound;
+}
+
+// Métodos de manipulação
+//
+
+/****************
+ * Funcao    : float compute(int numSweeps)                                                                *
+ * Descricao : Calcula o limite inferior: parte da subida dual e aplica até numSweeps varreduras de          *
+ *             subgradiente, com passo proporcional à distância até o limite superior da subida dual e      *
+ *             reduzido à metade após varreduras sem melhora. Com pesos inteiros, o limite é arredondado    *
+ *             para cima.                                                                                  *
+ * Parametros: numSweeps - número máximo de varreduras de subgradiente                                      *
+ * Retorno   : Retorna o limite inferior do custo de qualquer conjunto dominante.                          *
+ ***************/
+float DominatingSetLowerBound::compute(int numSweeps)
+{
+    double bestBound = this->dualAscent();
+    double stepFactor = 2;
+    int sweepsWithoutImprovement = 0;
+    for (int sweep = 0; sweep < numSweeps && bestBound < this->upperBound; sweep++)
+    {
+        double lagrangianBound = this->evaluate();
+        if (lagrangianBound > bestBound)
+        {
+            bestBound = lagrangianBound;
+            sweepsWithoutImprovement = 0;
+        }
+        else if (++sweepsWithoutImprovement >= STEP_PATIENCE)
+        {
+            stepFactor /= 2;
+            sweepsWithoutImprovement = 0;
+        }
+
+        // Norma do subgradiente projetado nos multiplicadores não negativos
+        double norm = 0;
+        for (int u = 0; u < this->size; u++)
+            if (this->subgradients[u] > 0 || this->multipliers[u] > 0)
+                norm += (double)this->subgradients[u] * this->subgradients[u];
+        if (norm == 0)
+            break;
+        double step = stepFactor * (this->upperBound - lagrangianBound) / norm;
+        for (int u = 0; u < this->size; u++)
+            this->multipliers[u] = max(0.0, this->multipliers[u] + step * this->subgradients[u]);
+    }
+
+    // Com pesos inteiros, nenhuma solução custa menos que o próximo inteiro
+    if (this->integralWeights)
+        bestBound = ceil(bestBound - 1e-6);
+    this->bound = (float)min(bestBound, (double)this->upperBound);
+    return this->bound;
+}
+
+// Métodos auxiliares
+//
+
+/****************
+ * Funcao    : double dualAscent()                                                                       *
+ * Descricao : Monta multiplicadores viáveis para o dual da cobertura: cada nó, do que tem menos nós que  *
+ *             o cobrem para o que tem mais, recebe a menor folga entre quem o cobre, descontada da folga *
+ *             de todos eles. Os nós sem folga formam uma solução dominante, cujo custo é o limite       *
+ *             superior usado no passo do subgradiente.                                                  *
+ * Parametros: sem parâmetros.                                                                           *
+ * Retorno   : Retorna o valor dual (soma dos multiplicadores).                                          *
+ ***************/
+double DominatingSetLowerBound::dualAscent()
+{
+    int *reverseOffsets = this->reverseGraph->getOffsets();
+    int *reverseTargets = this->reverseGraph->getTargets();
+
+    // A ordem dos nós usa o vetor dos subgradientes, ainda não calculados
+    int *order = this->subgradients;
+    for (int i = 0; i < this->size; i++)
+    {
+        order[i] = i;
+        this->reducedCosts[i] = this->weights[i];
+    }
+    sort(order, order + this->size, [reverseOffsets](int first, int second)
+         {
+        int firstCount = reverseOffsets[first + 1] - reverseOffsets[first];
+        int secondCount = reverseOffsets[second + 1] - reverseOffsets[second];
+        return firstCount != secondCount ? firstCount < secondCount : first < second; });
+
+    double dualValue = 0;
+    for (int i = 0; i < this->size; i++)
+    {
+        int nodeId = order[i];
+        double slack = this->reducedCosts[nodeId];
+        for (int r = reverseOffsets[nodeId]; r < reverseOffsets[nodeId + 1]; r++)
+            slack = min(slack, this->reducedCosts[reverseTargets[r]]);
+        slack = max(slack, 0.0);
+        this->multipliers[nodeId] = slack;
+        this->reducedCosts[nodeId] -= slack;
+        for (int r = reverseOffsets[nodeId]; r < reverseOffsets[nodeId + 1]; r++)
+            this->reducedCosts[reverseTargets[r]] -= slack;
+        dualValue += slack;
+    }
+
+    // Cada nó zerou a folga de algum nó que o cobre, então os nós sem folga dominam o grafo
+    double upperBound = 0;
+    for (int c = 0; c < this->size; c++)
+        if (this->reducedCosts[c] <= 0)
+            upperBound += this->weights[c];
+    this->upperBound = (float)upperBound;
+    return dualValue;
+}
+
+/****************
+ * Funcao    : double evaluate()                                                                          *
+ * Descricao : Avalia a relaxação lagrangiana nos multiplicadores correntes: calcula o custo reduzido de    *
+ *             cada nó, escolhe os de custo reduzido negativo e guarda o subgradiente de cada restrição     *
+ *             (1 menos a quantidade de nós escolhidos que cobrem o nó)                                    *
+ * Parametros: sem parâmetros.                                                                              *
+ * Retorno   : Retorna o valor da relaxação, um limite inferior válido.                                   *
+ ***************/
+double DominatingSetLowerBound::evaluate()
+{
+    int *offsets = this->forwardGraph->getOffsets();
+    int *targets = this->forwardGraph->getTargets();
+
+    double lagrangianBound = 0;
+    for (int u = 0; u < this->size; u++)
+    {
+        lagrangianBound += this->multipliers[u];
+        this->subgradients[u] = 1;
+    }
+    for (int c = 0; c < this->size; c++)
+    {
+        double reducedCost = this->weights[c] - this->multipliers[c];
+        for (int e = offsets[c]; e < offsets[c + 1]; e++)
+            reducedCost -= this->multipliers[targets[e]];
+        this->reducedCosts[c] = reducedCost;
+        if (reducedCost >= 0)
+            continue;
+        lagrangianBound += reducedCost;
+        this->subgradients[c]--;
+        for (int e = offsets[c]; e < offsets[c + 1]; e++)
+            this->subgradients[targets[e]]--;
+    }
+    return lagrangianBound;
+}
@@ -0,0 +1,50 @@
+/**************************************************************************************************
+ * Implementation of the TAD DominatingSetLowerBound
+ **************************************************************************************************/
+
+#ifndef DOMINATINGSETLOWERBOUND_H_INCLUDED
+#define DOMINATINGSETLOWERBOUND_H_INCLUDED
+#include "CompactGraph.h"
+
+using namespace std;
+
+// Limite inferior do conjunto dominante ponderado pela relaxação lagrangiana das restrições de
+// cobertura: uma subida dual gulosa dá os multiplicadores iniciais, melhorados por varreduras de
+// subgradiente, cada uma linear no tamanho do grafo.
+class DominatingSetLowerBound
+{
+    // Atributos
+private:
+    int size;
+    CompactGraph *forwardGraph;
+    CompactGraph *reverseGraph;
+    const float *weights;
+    bool integralWeights;
+    double *multipliers;
+    double *reducedCosts;
+    int *subgradients;
+    float upperBound;
+    float bound;
+
+public:
+    // Construtor
+    DominatingSetLowerBound(CompactGraph *forwardGraph, CompactGraph *reverseGraph, const float *weights);
+
+    // Destrutor
+    ~DominatingSetLowerBound();
+
+    // Getters
+    int getSize();
+    float getBound();
+    float getUpperBound();
+
+    // Métodos de manipulação
+    float compute(int numSweeps);
+
+private:
+    // Métodos auxiliares
+    double dualAscent();
+    double evaluate();
+};
+
+#endif // DOMINATINGSETLOWERBOUND_H_INCLUDED
@@ -0,0 +1,352 @@
+#include "DominatingSetReduction.h"
+#include <algorithm>
+
+using namespace std;
+
+/**************************************************************************************************
+ * Defining the DominatingSetReduction's methods
+ **************************************************************************************************/
+
+/****************
+ * Funcao    : DominatingSetReduction(Graph *graph)                                                   *
+ * Descricao : Aplica as regras de redução até um ponto fixo e monta o grafo residual:                *
+ *             - um nó descoberto com um único candidato que o cobre força esse candidato (nós        *
+ *               isolados forçam a si mesmos);                                                        *
+ *             - um candidato cujos nós descobertos cobertos estão todos na vizinhança de outro       *
+ *               candidato de peso menor ou igual é excluído (o vizinho de uma folha com peso menor   *
+ *               ou igual exclui a folha, e então é forçado pela regra anterior).                     *
+ * Parametros: graph - grafo do problema                                                              *
+ ***************/
+DominatingSetReduction::DominatingSetReduction(Graph *graph)
+{
+    this->size = graph->getOrder();
+    this->nodeList = graph->copyNodePointersToArray(&this->size);
+    this->forwardGraph = new CompactGraph(graph, false);
+    this->reverseGraph = graph->getDirected() ? new CompactGraph(graph, true) : this->forwardGraph;
+    this->coverageKernel = new CoverageKernel(graph);
+    this->uncovered = this->coverageKernel->createUncoveredSet();
+    this->remaining = allocBitset(this->coverageKernel->getNumberWords());
+    this->forced = new bool[this->size];
+    this->excluded = new bool[this->size];
+    this->dominators = new int[this->size];
+    for (int i = 0; i < this->size; i++)
+    {
+        this->forced[i] = this->excluded[i] = false;
+        this->dominators[i] = -1;
+    }
+    this->numberForced = 0;
+    this->forcedCost = 0;
+    this->numberExcluded = 0;
+
+    // Ponto fixo das regras
+    bool changed = true;
+    while (changed)
+    {
+        changed = this->forceNodes();
+        changed = this->excludeNodes() || changed;
+    }
+
+    this->residualGraph = nullptr;
+    this->originalIds = nullptr;
+    this->createResidualGraph(graph);
+}
+
+// Destrutor
+DominatingSetReduction::~DominatingSetReduction()
+{
+    delete[] this->nodeList;
+    if (this->reverseGraph != this->forwardGraph)
+        delete this->reverseGraph;
+    delete this->forwardGraph;
+    delete this->coverageKernel;
+    freeBitset(this->uncovered);
+    freeBitset(this->remaining);
+    delete[] this->forced;
+    delete[] this->excluded;
+    delete[] this->dominators;
+    delete this->residualGraph;
+    delete[] this->originalIds;
+    this->nodeList = nullptr;
+    this->forwardGraph = this->reverseGraph = nullptr;
+    this->coverageKernel = nullptr;
+    this->uncovered = this->remaining = nullptr;
+    this->forced = this->excluded = nullptr;
+    this->dominators = this->originalIds = nullptr;
+    this->residualGraph = nullptr;
+    this->size = 0;
+}
+
+// Getters
+int DominatingSetReduction::getNumberForced()
+{
+    return this->numberForced;
+}
+float DominatingSetReduction::getForcedCost()
+{
+    return this->forcedCost;
+}
+int DominatingSetReduction::getNumberExcluded()
+{
+    return this->numberExcluded;
+}
+Graph *DominatingSetReduction::getResidualGraph()
+{
+    return this->residualGraph;
+}
+
+// Métodos de manipulação
+//
+
+/****************
+ * Funcao    : list<SimpleNode> liftSolution(list<SimpleNode> residualSolution, float *totalCost)             *
+ * Descricao : Leva uma solução do grafo residual ao grafo original: acrescenta os nós forçados, descarta os *
+ *             pendentes, troca cada nó excluído escolhido pelo candidato que o excluiu e remove os nós que  *
+ *             ficaram redundantes, dos mais pesados para os mais leves                                      *
+ * Parametros: residualSolution - solução encontrada no grafo residual                                       *
+ *             totalCost - custo total da solução no grafo original                                          *
+ * Retorno   : Retorna uma lista de nós solução do grafo original.                                           *
+ ***************/
+list<SimpleNode> DominatingSetReduction::liftSolution(list<SimpleNode> residualSolution, float *totalCost)
+{
+    bool *inSolution = new bool[this->size];
+    for (int i = 0; i < this->size; i++)
+        inSolution[i] = this->forced[i];
+    for (auto &&node : residualSolution)
+    {
+        int nodeId = this->originalIds[node.id];
+        if (nodeId == -1)
+            continue;
+        while (this->excluded[nodeId])
+            nodeId = this->dominators[nodeId];
+        inSolution[nodeId] = true;
+    }
+
+    // Contadores de cobertura da solução
+    int *offsets = this->forwardGraph->getOffsets();
+    int *targets = this->forwardGraph->getTargets();
+    int *coverCounts = new int[this->size];
+    int *solution = new int[this->size];
+    int solutionSize = 0;
+    for (int i = 0; i < this->size; i++)
+        coverCounts[i] = 0;
+    for (int i = 0; i < this->size; i++)
+        if (inSolution[i])
+        {
+            solution[solutionSize++] = i;
+            coverCounts[i]++;
+            for (int e = offsets[i]; e < offsets[i + 1]; e++)
+                coverCounts[targets[e]]++;
+        }
+
+    // Remove os nós redundantes
+    Node **nodes = this->nodeList;
+    sort(solution, solution + solutionSize, [nodes](int first, int second)
+         { return nodes[first]->getWeight() != nodes[second]->getWeight() ? nodes[first]->getWeight() > nodes[second]->getWeight() : first < second; });
+    for (int i = 0; i < solutionSize; i++)
+    {
+        int nodeId = solution[i];
+        bool redundant = coverCounts[nodeId] >= 2;
+        for (int e = offsets[nodeId]; e < offsets[nodeId + 1] && redundant; e++)
+            redundant = coverCounts[targets[e]] >= 2;
+        if (!redundant)
+            continue;
+        inSolution[nodeId] = false;
+        coverCounts[nodeId]--;
+        for (int e = offsets[nodeId]; e < offsets[nodeId + 1]; e++)
+            coverCounts[targets[e]]--;
+    }
+
+    list<SimpleNode> solutionSet;
+    *totalCost = 0;
+    for (int i = 0; i < this->size; i++)
+        if (inSolution[i])
+        {
+            SimpleNode simpleNode;
+            simpleNode.id = i;
+            simpleNode.label = this->nodeList[i]->getLabel();
+            simpleNode.degree = this->nodeList[i]->getInDegree();
+            simpleNode.weight = this->nodeList[i]->getWeight();
+            solutionSet.emplace_back(simpleNode);
+            *totalCost += simpleNode.weight;
+        }
+
+    // Limpa a memória
+    delete[] inSolution;
+    delete[] coverCounts;
+    delete[] solution;
+
+    return solutionSet;
+}
+
+// Métodos auxiliares
+//
+
+void DominatingSetReduction::forceNode(int nodeId)
+{
+    this->forced[nodeId] = true;
+    this->numberForced++;
+    this->forcedCost += this->nodeList[nodeId]->getWeight();
+    this->coverageKernel->cover(this->uncovered, nodeId);
+}
+
+/****************
+ * Funcao    : bool forceNodes()                                                               *
+ * Descricao : Força na solução o único candidato capaz de cobrir algum nó ainda descoberto    *
+ * Parametros: Sem parâmetros.                                                                 *
+ * Retorno   : Retorna true se algum nó foi forçado.                                           *
+ ***************/
+bool DominatingSetReduction::forceNodes()
+{
+    int *reverseOffsets = this->reverseGraph->getOffsets();
+    int *reverseTargets = this->reverseGraph->getTargets();
+    bool changed = false;
+    for (int nodeId = 0; nodeId < this->size; nodeId++)
+    {
+        if (this->coverageKernel->isCovered(this->uncovered, nodeId))
+            continue;
+
+        // Candidatos que cobrem o nó: ele mesmo e os nós com aresta para ele
+        int numCandidates = 0;
+        int candidateId = -1;
+        for (int r = reverseOffsets[nodeId] - 1; r < reverseOffsets[nodeId + 1] && numCandidates < 2; r++)
+        {
+            int coveringId = r < reverseOffsets[nodeId] ? nodeId : reverseTargets[r];
+            if (!this->forced[coveringId] && !this->excluded[coveringId] && coveringId != candidateId)
+            {
+                numCandidates++;
+                candidateId = coveringId;
+            }
+        }
+        if (numCandidates == 1)
+        {
+            this->forceNode(candidateId);
+            changed = true;
+        }
+    }
+    return changed;
+}
+
+/****************
+ * Funcao    : bool excludeNodes()                                                                    *
+ * Descricao : Exclui dos candidatos os nós que não cobrem nenhum nó descoberto e os nós cujos        *
+ *             descobertos cobertos são todos cobertos por outro candidato de peso menor ou igual,    *
+ *             guardando esse candidato para a volta ao grafo original. A inclusão é testada sobre    *
+ *             as vizinhanças em bits (AND + popcount).                                               *
+ * Parametros: Sem parâmetros.                                                                        *
+ * Retorno   : Retorna true se algum nó foi excluído.                                                 *
+ ***************/
+bool DominatingSetReduction::excludeNodes()
+{
+    int *reverseOffsets = this->reverseGraph->getOffsets();
+    int *reverseTargets = this->reverseGraph->getTargets();
+    bool changed = false;
+    for (int nodeId = 0; nodeId < this->size; nodeId++)
+    {
+        if (this->forced[nodeId] || this->excluded[nodeId])
+            continue;
+
+        // Nós descobertos que o nó cobriria, só nas palavras da sua linha
+        int numRowWords = this->coverageKernel->getNumberRowWords(nodeId);
+        const int *rowIndices = this->coverageKernel->getRowIndices(nodeId);
+        const uint64_t *rowMasks = this->coverageKernel->getRowMasks(nodeId);
+        int firstWord = -1;
+        int remainingCount = 0;
+        for (int k = 0; k < numRowWords; k++)
+        {
+            int w = rowIndices[k];
+            this->remaining[w] = rowMasks[k] & this->uncovered[w];
+            remainingCount += __builtin_popcountll(this->remaining[w]);
+            if (firstWord == -1 && this->remaining[w] != 0)
+                firstWord = w;
+        }
+
+        int dominatorId = -1;
+        if (firstWord != -1)
+        {
+            // Quem cobre todos esses nós cobre também o primeiro deles
+            int firstId = firstWord * 64 + __builtin_ctzll(this->remaining[firstWord]);
+            for (int r = reverseOffsets[firstId] - 1; r < reverseOffsets[firstId + 1] && dominatorId == -1; r++)
+            {
+                int coveringId = r < reverseOffsets[firstId] ? firstId : reverseTargets[r];
+                if (coveringId == nodeId || this->forced[coveringId] || this->excluded[coveringId] ||
+                    this->nodeList[coveringId]->getWeight() > this->nodeList[nodeId]->getWeight())
+                    continue;
+                if (this->coverageKernel->gain(this->remaining, coveringId) == remainingCount)
+                    dominatorId = coveringId;
+            }
+        }
+        for (int k = 0; k < numRowWords; k++)
+            this->remaining[rowIndices[k]] = 0;
+        if (firstWord != -1 && dominatorId == -1)
+            continue;
+
+        this->excluded[nodeId] = true;
+        this->dominators[nodeId] = dominatorId;
+        this->numberExcluded++;
+        changed = true;
+    }
+    return changed;
+}
+
+/****************
+ * Funcao    : void createResidualGraph(Graph *graph)                                                *
+ * Descricao : Monta o grafo induzido pelos nós não forçados que ainda precisam ser cobertos ou      *
+ *             que ainda são candidatos, mantendo rótulos, pesos e arestas do grafo original. Um     *
+ *             candidato já coberto não precisa ser coberto de novo: ele recebe um vizinho pendente  *
+ *             de peso zero, que o cobre sem custo e é descartado na volta ao grafo original.        *
+ * Parametros: graph - grafo do problema                                                             *
+ * Retorno   : Sem retorno.                                                                          *
+ ***************/
+void DominatingSetReduction::createResidualGraph(Graph *graph)
+{
+    int *residualIds = new int[this->size];
+    int residualSize = 0;
+    int numPendants = 0;
+    for (int i = 0; i < this->size; i++)
+    {
+        bool covered = this->coverageKernel->isCovered(this->uncovered, i);
+        bool needed = !this->forced[i] && (!covered || !this->excluded[i]);
+        residualIds[i] = needed ? residualSize++ : -1;
+        if (needed && covered)
+            numPendants++;
+    }
+
+    int totalSize = residualSize + numPendants;
+    this->residualGraph = new Graph(totalSize, graph->getDirected(), graph->getWeightedEdge(), graph->getWeightedNode());
+    this->originalIds = new int[totalSize > 0 ? totalSize : 1];
+    Node **residualNodes = new Node *[residualSize > 0 ? residualSize : 1];
+    for (int i = 0; i < this->size; i++)
+        if (residualIds[i] != -1)
+        {
+            this->originalIds[residualIds[i]] = i;
+            residualNodes[residualIds[i]] = this->residualGraph->insertNode(this->nodeList[i]->getLabel(), this->nodeList[i]->getWeight());
+        }
+    for (int i = 0; i < this->size; i++)
+        if (residualIds[i] != -1 && this->coverageKernel->isCovered(this->uncovered, i))
+        {
+            Node *pendant = this->residualGraph->insertNode(-this->nodeList[i]->getLabel(), 0);
+            this->originalIds[pendant->getId()] = -1;
+            this->residualGraph->insertEdge(pendant, residualNodes[residualIds[i]], 0);
+        }
+    this->residualGraph->fixOrder();
+
+    // Arestas induzidas; em grafos não direcionados cada aresta é inserida uma única vez
+    int *offsets = this->forwardGraph->getOffsets();
+    int *targets = this->forwardGraph->getTargets();
+    float *edgeWeights = this->forwardGraph->getEdgeWeights();
+    for (int i = 0; i < this->size; i++)
+    {
+        if (residualIds[i] == -1)
+            continue;
+        for (int e = offsets[i]; e < offsets[i + 1]; e++)
+        {
+            int targetId = targets[e];
+            if (residualIds[targetId] != -1 && (graph->getDirected() || i < targetId))
+                this->residualGraph->insertEdge(residualNodes[residualIds[i]], residualNodes[residualIds[targetId]], edgeWeights[e]);
+        }
+    }
+
+    // Limpa a memória
+    delete[] residualIds;
+    delete[] residualNodes;
+}
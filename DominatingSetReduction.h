@@ -0,0 +1,62 @@
+/**************************************************************************************************
+ * Implementation of the TAD DominatingSetReduction
+ **************************************************************************************************/
+
+#ifndef DOMINATINGSETREDUCTION_H_INCLUDED
+#define DOMINATINGSETREDUCTION_H_INCLUDED
+#include "Graph.h"
+#include "CompactGraph.h"
+#include "CoverageKernel.h"
+#include <list>
+
+using namespace std;
+
+// Redução (kernelização) do conjunto dominante ponderado: fixa na solução os nós obrigatórios,
+// exclui dos candidatos os nós cuja vizinhança é coberta por um nó mais barato e monta o grafo
+// residual que os algoritmos resolvem; a solução do grafo residual é depois levada de volta ao
+// grafo original.
+class DominatingSetReduction
+{
+    // Atributos
+private:
+    int size;
+    Node **nodeList;
+    CompactGraph *forwardGraph;
+    CompactGraph *reverseGraph;
+    CoverageKernel *coverageKernel;
+    uint64_t *uncovered;
+    uint64_t *remaining;
+    bool *forced;
+    bool *excluded;
+    int *dominators;
+    int numberForced;
+    float forcedCost;
+    int numberExcluded;
+    Graph *residualGraph;
+    int *originalIds;
+
+public:
+    // Construtor
+    DominatingSetReduction(Graph *graph);
+
+    // Destrutor
+    ~DominatingSetReduction();
+
+    // Getters
+    int getNumberForced();
+    float getForcedCost();
+    int getNumberExcluded();
+    Graph *getResidualGraph();
+
+    // Métodos de manipulação
+    list<SimpleNode> liftSolution(list<SimpleNode> residualSolution, float *totalCost);
+
+private:
+    // Métodos auxiliares
+    void forceNode(int nodeId);
+    bool forceNodes();
+    bool excludeNodes();
+    void createResidualGraph(Graph *graph);
+};
+
+#endif // DOMINATINGSETREDUCTION_H_INCLUDED
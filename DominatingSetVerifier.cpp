@@ -0,0 +1,188 @@
+#include "DominatingSetVerifier.h"
+#include "bitset/bitset.h"
+#include "thread/parallel.h"
+#include <cmath>
+#include <sstream>
+#include <string>
+
+using namespace std;
+
+// Quantidade mínima de adjacências percorridas por thread na marcação dos nós cobertos
+static const int VERIFY_GRAIN = 1 << 16;
+
+/**************************************************************************************************
+ * Defining the DominatingSetVerifier's methods
+ **************************************************************************************************/
+
+/****************
+ * Funcao    : DominatingSetVerifier(Graph *graph)                                 *
+ * Descricao : Prepara as adjacências do grafo em que as soluções serão conferidas *
+ * Parametros: graph - grafo do problema                                           *
+ ***************/
+DominatingSetVerifier::DominatingSetVerifier(Graph *graph)
+{
+    this->graph = graph;
+    this->nodeList = graph->copyNodePointersToArray(&this->size);
+    this->numWords = bitsetWords(this->size);
+    this->forwardGraph = new CompactGraph(graph, false);
+    this->inSolution = new bool[this->size];
+    for (int i = 0; i < this->size; i++)
+        this->inSolution[i] = false;
+    this->numberUncovered = 0;
+    this->numberInvalid = 0;
+    this->verifiedCost = 0;
+}
+
+// Destrutor
+DominatingSetVerifier::~DominatingSetVerifier()
+{
+    delete[] this->nodeList;
+    delete this->forwardGraph;
+    delete[] this->inSolution;
+    this->nodeList = nullptr;
+    this->forwardGraph = nullptr;
+    this->inSolution = nullptr;
+    this->graph = nullptr;
+    this->size = 0;
+}
+
+// Getters
+int DominatingSetVerifier::getNumberUncovered()
+{
+    return this->numberUncovered;
+}
+int DominatingSetVerifier::getNumberInvalid()
+{
+    return this->numberInvalid;
+}
+float DominatingSetVerifier::getVerifiedCost()
+{
+    return this->verifiedCost;
+}
+
+// Métodos de manipulação
+//
+
+/****************
+ * Funcao    : bool verify(list<SimpleNode> solution, float totalCost, int numThreads)               *
+ * Descricao : Confere uma solução devolvida pelos algoritmos, identificada pelos ids dos nós         *
+ * Parametros: solution - lista de nós da solução                                                     *
+ *             totalCost - custo informado da solução                                                 *
+ *             numThreads - quantidade máxima de threads; valores <= 0 usam todos os núcleos          *
+ * Retorno   : Retorna true se a solução domina o grafo, sem nós repetidos, com o custo informado.   *
+ ***************/
+bool DominatingSetVerifier::verify(list<SimpleNode> solution, float totalCost, int numThreads)
+{
+    int solutionSize = solution.size();
+    int *ids = new int[solutionSize > 0 ? solutionSize : 1];
+    int i = 0;
+    for (auto &&node : solution)
+        ids[i++] = node.id;
+    bool valid = this->verifyIds(ids, solutionSize, totalCost, numThreads);
+    delete[] ids;
+    return valid;
+}
+
+/****************
+ * Funcao    : bool verifyFile(ifstream &solutionFile, int numThreads)                                           *
+ * Descricao : Confere uma solução salva pelo programa: lê o custo da linha "Custo:" e os rótulos dos nós da       *
+ *             tabela que segue a linha "Label"; rótulos que não existem no grafo contam como nós inválidos       *
+ * Parametros: solutionFile - arquivo de resultado com a lista de vértices                                       *
+ *             numThreads - quantidade máxima de threads; valores <= 0 usam todos os núcleos                      *
+ * Retorno   : Retorna true se a solução domina o grafo, sem nós repetidos, com o custo informado.               *
+ ***************/
+bool DominatingSetVerifier::verifyFile(ifstream &solutionFile, int numThreads)
+{
+    list<SimpleNode> solution;
+    float totalCost = 0;
+    bool readingNodes = false;
+    string line;
+    while (getline(solutionFile, line))
+    {
+        if (line.rfind("Custo: ", 0) == 0)
+            totalCost = atof(line.substr(7).c_str());
+        else if (line.rfind("Label", 0) == 0)
+            readingNodes = true;
+        else if (readingNodes)
+        {
+            istringstream stream(line);
+            int label;
+            if (!(stream >> label))
+                continue;
+            Node *node = this->graph->getNodeByLabel(label);
+            SimpleNode simpleNode;
+            simpleNode.id = node != nullptr ? node->getId() : -1;
+            simpleNode.label = label;
+            solution.emplace_back(simpleNode);
+        }
+    }
+    return this->verify(solution, totalCost, numThreads);
+}
+
+// Métodos auxiliares
+//
+
+/****************
+ * Funcao    : bool verifyIds(int *solution, int solutionSize, float totalCost, int numThreads)                  *
+ * Descricao : Descarta ids inexistentes e repetidos, soma o custo e marca os nós cobertos: cada thread marca a   *
+ *             vizinhança fechada de uma parte da solução no seu conjunto de bits, e os conjuntos são unidos      *
+ *             palavra a palavra antes da contagem dos nós não dominados                                         *
+ * Parametros: solution - ids dos nós da solução                                                                 *
+ *             solutionSize - quantidade de nós da solução                                                       *
+ *             totalCost - custo informado da solução                                                            *
+ *             numThreads - quantidade máxima de threads; valores <= 0 usam todos os núcleos                      *
+ * Retorno   : Retorna true se a solução é válida.                                                               *
+ ***************/
+bool DominatingSetVerifier::verifyIds(int *solution, int solutionSize, float totalCost, int numThreads)
+{
+    int *offsets = this->forwardGraph->getOffsets();
+    int *targets = this->forwardGraph->getTargets();
+
+    // Nós válidos, custo e quantidade de adjacências a percorrer
+    int *validIds = new int[solutionSize > 0 ? solutionSize : 1];
+    int numberValid = 0;
+    double cost = 0;
+    long long numberAdjacencies = 0;
+    this->numberInvalid = 0;
+    for (int i = 0; i < solutionSize; i++)
+    {
+        int nodeId = solution[i];
+        if (nodeId < 0 || nodeId >= this->size || this->inSolution[nodeId])
+        {
+            this->numberInvalid++;
+            continue;
+        }
+        this->inSolution[nodeId] = true;
+        validIds[numberValid++] = nodeId;
+        cost += this->nodeList[nodeId]->getWeight();
+        numberAdjacencies += offsets[nodeId + 1] - offsets[nodeId] + 1;
+    }
+    for (int i = 0; i < numberValid; i++)
+        this->inSolution[validIds[i]] = false;
+    this->verifiedCost = (float)cost;
+
+    // Marca os nós cobertos, dividindo a solução entre as threads só em grafos grandes
+    int numTasks = (int)min((long long)resolveThreads(numThreads), max(1LL, numberAdjacencies / VERIFY_GRAIN));
+    uint64_t *covered = allocBitset(numTasks * this->numWords);
+    parallelFor(numTasks, numTasks, [&](int task, int /*thread*/)
+                {
+        uint64_t *taskCovered = covered + (size_t)task * this->numWords;
+        for (int i = task; i < numberValid; i += numTasks)
+        {
+            int nodeId = validIds[i];
+            taskCovered[nodeId / 64] |= (uint64_t)1 << (nodeId % 64);
+            for (int e = offsets[nodeId]; e < offsets[nodeId + 1]; e++)
+                taskCovered[targets[e] / 64] |= (uint64_t)1 << (targets[e] % 64);
+        } });
+    for (int task = 1; task < numTasks; task++)
+        for (int w = 0; w < this->numWords; w++)
+            covered[w] |= covered[(size_t)task * this->numWords + w];
+    this->numberUncovered = this->size - popcountBitset(covered, this->numWords);
+
+    // Limpa a memória
+    freeBitset(covered);
+    delete[] validIds;
+
+    bool costMatches = fabs(cost - totalCost) <= 1e-4 * max(1.0, fabs(cost));
+    return this->numberUncovered == 0 && this->numberInvalid == 0 && costMatches;
+}
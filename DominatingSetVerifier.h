@@ -0,0 +1,52 @@
+/**************************************************************************************************
+ * Implementation of the TAD DominatingSetVerifier
+ **************************************************************************************************/
+
+#ifndef DOMINATINGSETVERIFIER_H_INCLUDED
+#define DOMINATINGSETVERIFIER_H_INCLUDED
+#include "Graph.h"
+#include "CompactGraph.h"
+#include <fstream>
+#include <list>
+
+using namespace std;
+
+// Verificação independente de uma solução do conjunto dominante ponderado: marca em bits os nós
+// cobertos pela solução (em paralelo, com um conjunto por thread unido palavra a palavra) e confere
+// a dominação, nós repetidos ou inexistentes e o custo informado.
+class DominatingSetVerifier
+{
+    // Atributos
+private:
+    int size;
+    int numWords;
+    Graph *graph;
+    Node **nodeList;
+    CompactGraph *forwardGraph;
+    bool *inSolution;
+    int numberUncovered;
+    int numberInvalid;
+    float verifiedCost;
+
+public:
+    // Construtor
+    DominatingSetVerifier(Graph *graph);
+
+    // Destrutor
+    ~DominatingSetVerifier();
+
+    // Getters
+    int getNumberUncovered();
+    int getNumberInvalid();
+    float getVerifiedCost();
+
+    // Métodos de manipulação
+    bool verify(list<SimpleNode> solution, float totalCost, int numThreads);
+    bool verifyFile(ifstream &solutionFile, int numThreads);
+
+private:
+    // Métodos auxiliares
+    bool verifyIds(int *solution, int solutionSize, float totalCost, int numThreads);
+};
+
+#endif // DOMINATINGSETVERIFIER_H_INCLUDED
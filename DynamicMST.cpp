@@ -0,0 +1,387 @@
+#include "DynamicMST.h"
+#include <algorithm>
+#include <cfloat>
+#include <iostream>
+
+using namespace std;
+
+/**************************************************************************************************
+ * Defining the DynamicMST's methods
+ **************************************************************************************************/
+
+// Construtor
+DynamicMST::DynamicMST(int size)
+{
+    this->size = max(size, 1);
+    this->parents = new int[2 * this->size];
+    this->leftChildren = new int[2 * this->size];
+    this->rightChildren = new int[2 * this->size];
+    this->reversed = new bool[2 * this->size];
+    this->values = new float[2 * this->size];
+    this->maxNodes = new int[2 * this->size];
+    this->splayStack = new int[2 * this->size];
+    this->edges = new SimpleEdge[this->size];
+    this->freeSlots = new int[this->size];
+    this->clear();
+}
+
+// Destrutor
+DynamicMST::~DynamicMST()
+{
+    delete[] this->parents;
+    delete[] this->leftChildren;
+    delete[] this->rightChildren;
+    delete[] this->reversed;
+    delete[] this->values;
+    delete[] this->maxNodes;
+    delete[] this->splayStack;
+    delete[] this->edges;
+    delete[] this->freeSlots;
+    this->parents = this->leftChildren = this->rightChildren = nullptr;
+    this->reversed = nullptr;
+    this->values = nullptr;
+    this->maxNodes = this->splayStack = this->freeSlots = nullptr;
+    this->edges = nullptr;
+    this->size = 0;
+    this->numberEdges = 0;
+}
+
+// Getters
+int DynamicMST::getSize()
+{
+    return this->size;
+}
+int DynamicMST::getNumberEdges()
+{
+    return this->numberEdges;
+}
+float DynamicMST::getTotalWeight()
+{
+    return this->totalWeight;
+}
+
+/****************
+ * Funcao    : int getEdges(SimpleEdge *edges)                                      *
+ * Descricao : Copia as arestas da floresta geradora mínima atual                    *
+ * Parametros: edges - vetor com espaço para getNumberEdges() arestas               *
+ * Retorno   : Retorna a quantidade de arestas copiadas.                            *
+ ***************/
+int DynamicMST::getEdges(SimpleEdge *edges)
+{
+    int count = 0;
+    for (int slot = 0; slot < this->size; slot++)
+        if (this->edges[slot].sourceNodeId != -1)
+            edges[count++] = this->edges[slot];
+    return count;
+}
+
+// Métodos de manipulação
+//
+
+/****************
+ * Funcao    : void clear()                                                   *
+ * Descricao : Esvazia a floresta, mantendo a capacidade                      *
+ * Parametros: Sem parâmetros.                                                *
+ * Retorno   : Sem retorno.                                                   *
+ ***************/
+void DynamicMST::clear()
+{
+    this->numberEdges = 0;
+    this->totalWeight = 0;
+    this->numFreeSlots = this->size;
+    for (int i = 0; i < 2 * this->size; i++)
+    {
+        this->parents[i] = this->leftChildren[i] = this->rightChildren[i] = -1;
+        this->reversed[i] = false;
+        this->values[i] = -FLT_MAX;
+        this->maxNodes[i] = i;
+    }
+    for (int i = 0; i < this->size; i++)
+    {
+        this->freeSlots[i] = this->size - 1 - i;
+        this->edges[i].sourceNodeId = -1;
+    }
+}
+
+/****************
+ * Funcao    : void reserve(int minSize)                                                          *
+ * Descricao : Garante espaço para os nós de id 0..minSize-1, ao menos dobrando a capacidade. Os  *
+ *             nós que representam arestas ficam depois dos nós do grafo, então os seus índices   *
+ *             são deslocados em todos os apontadores da link-cut tree; a floresta é preservada.  *
+ * Parametros: minSize - quantidade mínima de nós                                                *
+ * Retorno   : Sem retorno.                                                                      *
+ ***************/
+void DynamicMST::reserve(int minSize)
+{
+    if (minSize <= this->size)
+        return;
+    int oldSize = this->size;
+    int newSize = max(minSize, 2 * oldSize);
+    int shift = newSize - oldSize;
+    auto remap = [oldSize, shift](int node)
+    { return node < oldSize ? node : node + shift; };
+
+    int *parents = new int[2 * newSize];
+    int *leftChildren = new int[2 * newSize];
+    int *rightChildren = new int[2 * newSize];
+    bool *reversed = new bool[2 * newSize];
+    float *values = new float[2 * newSize];
+    int *maxNodes = new int[2 * newSize];
+    for (int i = 0; i < 2 * newSize; i++)
+    {
+        parents[i] = leftChildren[i] = rightChildren[i] = -1;
+        reversed[i] = false;
+        values[i] = -FLT_MAX;
+        maxNodes[i] = i;
+    }
+    for (int i = 0; i < 2 * oldSize; i++)
+    {
+        int node = remap(i);
+        parents[node] = this->parents[i] == -1 ? -1 : remap(this->parents[i]);
+        leftChildren[node] = this->leftChildren[i] == -1 ? -1 : remap(this->leftChildren[i]);
+        rightChildren[node] = this->rightChildren[i] == -1 ? -1 : remap(this->rightChildren[i]);
+        reversed[node] = this->reversed[i];
+        values[node] = this->values[i];
+        maxNodes[node] = remap(this->maxNodes[i]);
+    }
+
+    // As novas posições de aresta entram no fim da pilha, depois das livres que já existiam
+    SimpleEdge *edges = new SimpleEdge[newSize];
+    int *freeSlots = new int[newSize];
+    int numFreeSlots = 0;
+    for (int slot = newSize - 1; slot >= oldSize; slot--)
+        freeSlots[numFreeSlots++] = slot;
+    for (int i = 0; i < this->numFreeSlots; i++)
+        freeSlots[numFreeSlots++] = this->freeSlots[i];
+    for (int slot = 0; slot < newSize; slot++)
+        edges[slot].sourceNodeId = -1;
+    for (int slot = 0; slot < oldSize; slot++)
+        edges[slot] = this->edges[slot];
+
+    delete[] this->parents;
+    delete[] this->leftChildren;
+    delete[] this->rightChildren;
+    delete[] this->reversed;
+    delete[] this->values;
+    delete[] this->maxNodes;
+    delete[] this->splayStack;
+    delete[] this->edges;
+    delete[] this->freeSlots;
+    this->parents = parents;
+    this->leftChildren = leftChildren;
+    this->rightChildren = rightChildren;
+    this->reversed = reversed;
+    this->values = values;
+    this->maxNodes = maxNodes;
+    this->splayStack = new int[2 * newSize];
+    this->edges = edges;
+    this->freeSlots = freeSlots;
+    this->numFreeSlots = numFreeSlots;
+    this->size = newSize;
+}
+
+/****************
+ * Funcao    : bool insertEdge(SimpleEdge edge)                                                 *
+ * Descricao : Atualiza a floresta com uma nova aresta: se liga dois componentes, entra na      *
+ *             árvore; senão, substitui a aresta mais pesada do ciclo formado, se for mais leve *
+ *             que ela (propriedade do ciclo). Custo O(log n) amortizado. Pontas com id além da *
+ *             capacidade a ampliam (reserve).                                                  *
+ * Parametros: edge - aresta inserida, com as pontas identificadas pelo id dos nós               *
+ * Retorno   : Retorna true se a floresta mudou.                                                *
+ ***************/
+bool DynamicMST::insertEdge(SimpleEdge edge)
+{
+    int sourceId = edge.sourceNodeId;
+    int targetId = edge.targetNodeId;
+    if (sourceId < 0 || targetId < 0)
+    {
+        cout << "ERRO: Aresta com id de no invalido na arvore geradora minima dinamica!" << endl;
+        return false;
+    }
+    // Um laço nunca entra na floresta
+    if (sourceId == targetId)
+        return false;
+    this->reserve(max(sourceId, targetId) + 1);
+
+    if (this->connected(sourceId, targetId))
+    {
+        // Aresta mais pesada do caminho entre as pontas
+        this->makeRoot(sourceId);
+        this->access(targetId);
+        int heaviest = this->maxNodes[targetId];
+        if (this->values[heaviest] <= edge.weight)
+            return false;
+
+        int slot = heaviest - this->size;
+        this->cut(heaviest, this->edges[slot].sourceNodeId);
+        this->cut(heaviest, this->edges[slot].targetNodeId);
+        this->values[heaviest] = -FLT_MAX;
+        this->maxNodes[heaviest] = heaviest;
+        this->totalWeight -= this->edges[slot].weight;
+        this->edges[slot].sourceNodeId = -1;
+        this->numberEdges--;
+        this->freeSlots[this->numFreeSlots++] = slot;
+    }
+
+    int slot = this->freeSlots[--this->numFreeSlots];
+    int edgeNode = this->size + slot;
+    this->edges[slot] = edge;
+    this->values[edgeNode] = edge.weight;
+    this->maxNodes[edgeNode] = edgeNode;
+    this->link(sourceId, edgeNode);
+    this->link(edgeNode, targetId);
+    this->totalWeight += edge.weight;
+    this->numberEdges++;
+    return true;
+}
+
+/****************
+ * Funcao    : bool connected(int firstId, int secondId)                    *
+ * Descricao : Verifica se dois nós estão na mesma árvore da floresta        *
+ * Parametros: firstId - id do primeiro nó                                  *
+ *             secondId - id do segundo nó                                  *
+ * Retorno   : Retorna true se estão conectados.                            *
+ ***************/
+bool DynamicMST::connected(int firstId, int secondId)
+{
+    if (firstId < 0 || secondId < 0 || firstId >= this->size || secondId >= this->size)
+        return firstId == secondId;
+    return this->findRoot(firstId) == this->findRoot(secondId);
+}
+
+// Métodos auxiliares
+//
+
+bool DynamicMST::isSplayRoot(int node)
+{
+    int parent = this->parents[node];
+    return parent == -1 || (this->leftChildren[parent] != node && this->rightChildren[parent] != node);
+}
+
+void DynamicMST::pushDown(int node)
+{
+    if (!this->reversed[node])
+        return;
+    int aux = this->leftChildren[node];
+    this->leftChildren[node] = this->rightChildren[node];
+    this->rightChildren[node] = aux;
+    if (this->leftChildren[node] != -1)
+        this->reversed[this->leftChildren[node]] = !this->reversed[this->leftChildren[node]];
+    if (this->rightChildren[node] != -1)
+        this->reversed[this->rightChildren[node]] = !this->reversed[this->rightChildren[node]];
+    this->reversed[node] = false;
+}
+
+void DynamicMST::update(int node)
+{
+    int best = node;
+    int left = this->leftChildren[node];
+    int right = this->rightChildren[node];
+    if (left != -1 && this->values[this->maxNodes[left]] > this->values[best])
+        best = this->maxNodes[left];
+    if (right != -1 && this->values[this->maxNodes[right]] > this->values[best])
+        best = this->maxNodes[right];
+    this->maxNodes[node] = best;
+}
+
+void DynamicMST::rotate(int node)
+{
+    int parent = this->parents[node];
+    int grandparent = this->parents[parent];
+    if (!this->isSplayRoot(parent))
+    {
+        if (this->leftChildren[grandparent] == parent)
+            this->leftChildren[grandparent] = node;
+        else
+            this->rightChildren[grandparent] = node;
+    }
+    if (this->leftChildren[parent] == node)
+    {
+        this->leftChildren[parent] = this->rightChildren[node];
+        if (this->rightChildren[node] != -1)
+            this->parents[this->rightChildren[node]] = parent;
+        this->rightChildren[node] = parent;
+    }
+    else
+    {
+        this->rightChildren[parent] = this->leftChildren[node];
+        if (this->leftChildren[node] != -1)
+            this->parents[this->leftChildren[node]] = parent;
+        this->leftChildren[node] = parent;
+    }
+    this->parents[parent] = node;
+    this->parents[node] = grandparent;
+    this->update(parent);
+    this->update(node);
+}
+
+void DynamicMST::splay(int node)
+{
+    // Propaga as inversões pendentes do topo da splay tree até o nó
+    int top = 0;
+    this->splayStack[top++] = node;
+    for (int current = node; !this->isSplayRoot(current); current = this->parents[current])
+        this->splayStack[top++] = this->parents[current];
+    while (top > 0)
+        this->pushDown(this->splayStack[--top]);
+
+    while (!this->isSplayRoot(node))
+    {
+        int parent = this->parents[node];
+        if (!this->isSplayRoot(parent))
+        {
+            int grandparent = this->parents[parent];
+            bool zigZig = (this->leftChildren[grandparent] == parent) == (this->leftChildren[parent] == node);
+            this->rotate(zigZig ? parent : node);
+        }
+        this->rotate(node);
+    }
+}
+
+void DynamicMST::access(int node)
+{
+    int last = -1;
+    for (int current = node; current != -1; current = this->parents[current])
+    {
+        this->splay(current);
+        this->rightChildren[current] = last;
+        this->update(current);
+        last = current;
+    }
+    this->splay(node);
+}
+
+void DynamicMST::makeRoot(int node)
+{
+    this->access(node);
+    this->reversed[node] = !this->reversed[node];
+}
+
+int DynamicMST::findRoot(int node)
+{
+    this->access(node);
+    int root = node;
+    this->pushDown(root);
+    while (this->leftChildren[root] != -1)
+    {
+        root = this->leftChildren[root];
+        this->pushDown(root);
+    }
+    this->splay(root);
+    return root;
+}
+
+void DynamicMST::link(int firstNode, int secondNode)
+{
+    this->makeRoot(firstNode);
+    this->parents[firstNode] = secondNode;
+}
+
+void DynamicMST::cut(int firstNode, int secondNode)
+{
+    this->makeRoot(firstNode);
+    this->access(secondNode);
+    this->leftChildren[secondNode] = -1;
+    this->parents[firstNode] = -1;
+    this->update(secondNode);
+}
@@ -0,0 +1,65 @@
+/**************************************************************************************************
+ * Implementation of the TAD DynamicMST
+ **************************************************************************************************/
+
+#ifndef DYNAMICMST_H_INCLUDED
+#define DYNAMICMST_H_INCLUDED
+#include "Edge.h"
+
+using namespace std;
+
+// Floresta geradora mínima mantida sob inserção de arestas, sobre uma link-cut tree em que cada
+// aresta da árvore é também um nó (ids 0..size-1 são os nós do grafo e size..2·size-1 as arestas). A
+// capacidade cresce quando uma aresta chega a um nó com id além dela.
+class DynamicMST
+{
+    // Atributos
+private:
+    int size;
+    int numberEdges;
+    float totalWeight;
+    int *parents;
+    int *leftChildren;
+    int *rightChildren;
+    bool *reversed;
+    float *values;
+    int *maxNodes;
+    SimpleEdge *edges;
+    int *freeSlots;
+    int numFreeSlots;
+    int *splayStack;
+
+public:
+    // Construtor
+    DynamicMST(int size);
+
+    // Destrutor
+    ~DynamicMST();
+
+    // Getters
+    int getSize();
+    int getNumberEdges();
+    float getTotalWeight();
+    int getEdges(SimpleEdge *edges);
+
+    // Métodos de manipulação
+    void clear();
+    void reserve(int minSize);
+    bool insertEdge(SimpleEdge edge);
+    bool connected(int firstId, int secondId);
+
+private:
+    // Métodos auxiliares
+    bool isSplayRoot(int node);
+    void pushDown(int node);
+    void update(int node);
+    void rotate(int node);
+    void splay(int node);
+    void access(int node);
+    void makeRoot(int node);
+    int findRoot(int node);
+    void link(int firstNode, int secondNode);
+    void cut(int firstNode, int secondNode);
+};
+
+#endif // DYNAMICMST_H_INCLUDED
@@ -0,0 +1,123 @@
+#include "ElitePool.h"
+#include <algorithm>
+
+using namespace std;
+
+/**************************************************************************************************
+ * Defining the ElitePool's methods
+ **************************************************************************************************/
+
+/****************
+ * Funcao    : ElitePool(int capacity, int size)                                      *
+ * Descricao : Aloca o conjunto elite vazio                                            *
+ * Parametros: capacity - quantidade máxima de soluções guardadas                      *
+ *             size - quantidade de nós do grafo (tamanho máximo de uma solução)       *
+ ***************/
+ElitePool::ElitePool(int capacity, int size)
+{
+    this->capacity = max(capacity, 0);
+    this->size = size;
+    this->numberSolutions = 0;
+    this->solutions = new int *[this->capacity > 0 ? this->capacity : 1];
+    this->solutionSizes = new int[this->capacity > 0 ? this->capacity : 1];
+    this->costs = new float[this->capacity > 0 ? this->capacity : 1];
+    for (int i = 0; i < this->capacity; i++)
+        this->solutions[i] = new int[size > 0 ? size : 1];
+    this->sortedSolution = new int[size > 0 ? size : 1];
+}
+
+// Destrutor
+ElitePool::~ElitePool()
+{
+    for (int i = 0; i < this->capacity; i++)
+        delete[] this->solutions[i];
+    delete[] this->solutions;
+    delete[] this->solutionSizes;
+    delete[] this->costs;
+    delete[] this->sortedSolution;
+    this->solutions = nullptr;
+    this->solutionSizes = this->sortedSolution = nullptr;
+    this->costs = nullptr;
+    this->capacity = this->numberSolutions = this->size = 0;
+}
+
+// Getters
+int ElitePool::getCapacity()
+{
+    return this->capacity;
+}
+int ElitePool::getNumberSolutions()
+{
+    return this->numberSolutions;
+}
+int *ElitePool::getSolution(int index)
+{
+    return this->solutions[index];
+}
+int ElitePool::getSolutionSize(int index)
+{
+    return this->solutionSizes[index];
+}
+float ElitePool::getCost(int index)
+{
+    return this->costs[index];
+}
+
+// Métodos de manipulação
+//
+
+/****************
+ * Funcao    : bool insert(const int *solution, int solutionSize, float cost)                    *
+ * Descricao : Oferece uma solução ao conjunto elite; com o conjunto cheio, ela substitui a pior *
+ *             se for mais barata (empate pela mais antiga, que permanece)                       *
+ * Parametros: solution - ids dos nós da solução                                                 *
+ *             solutionSize - quantidade de nós da solução                                       *
+ *             cost - custo da solução                                                           *
+ * Retorno   : Retorna true se a solução entrou no conjunto.                                     *
+ ***************/
+bool ElitePool::insert(const int *solution, int solutionSize, float cost)
+{
+    if (this->capacity == 0)
+        return false;
+    int position = this->numberSolutions < this->capacity ? this->numberSolutions : this->worstIndex();
+    if (this->numberSolutions == this->capacity && cost >= this->costs[position])
+        return false;
+
+    for (int i = 0; i < solutionSize; i++)
+        this->sortedSolution[i] = solution[i];
+    sort(this->sortedSolution, this->sortedSolution + solutionSize);
+    if (this->contains(this->sortedSolution, solutionSize))
+        return false;
+
+    // Troca os vetores em vez de copiar a solução ordenada
+    int *aux = this->solutions[position];
+    this->solutions[position] = this->sortedSolution;
+    this->sortedSolution = aux;
+    this->solutionSizes[position] = solutionSize;
+    this->costs[position] = cost;
+    if (position == this->numberSolutions)
+        this->numberSolutions++;
+    return true;
+}
+
+// Métodos auxiliares
+//
+
+// Verifica se uma solução, com os ids ordenados, já está no conjunto
+bool ElitePool::contains(const int *sortedSolution, int solutionSize)
+{
+    for (int i = 0; i < this->numberSolutions; i++)
+        if (this->solutionSizes[i] == solutionSize && equal(sortedSolution, sortedSolution + solutionSize, this->solutions[i]))
+            return true;
+    return false;
+}
+
+// Índice da solução mais cara do conjunto (empate pela de maior índice)
+int ElitePool::worstIndex()
+{
+    int worst = 0;
+    for (int i = 1; i < this->numberSolutions; i++)
+        if (this->costs[i] >= this->costs[worst])
+            worst = i;
+    return worst;
+}
@@ -0,0 +1,49 @@
+/**************************************************************************************************
+ * Implementation of the TAD ElitePool
+ **************************************************************************************************/
+
+#ifndef ELITEPOOL_H_INCLUDED
+#define ELITEPOOL_H_INCLUDED
+
+using namespace std;
+
+// Conjunto elite do GRASP: as melhores soluções distintas encontradas, limitadas a uma capacidade
+// fixa e guardadas como vetores de ids ordenados. Uma solução nova entra se for diferente de todas as
+// do conjunto e, com o conjunto cheio, mais barata que a pior, que ela substitui. Não é sincronizado:
+// as inserções são feitas por uma só thread, entre os blocos de iterações.
+class ElitePool
+{
+    // Atributos
+private:
+    int capacity;
+    int size;
+    int numberSolutions;
+    int **solutions;
+    int *solutionSizes;
+    float *costs;
+    int *sortedSolution;
+
+public:
+    // Construtor
+    ElitePool(int capacity, int size);
+
+    // Destrutor
+    ~ElitePool();
+
+    // Getters
+    int getCapacity();
+    int getNumberSolutions();
+    int *getSolution(int index);
+    int getSolutionSize(int index);
+    float getCost(int index);
+
+    // Métodos de manipulação
+    bool insert(const int *solution, int solutionSize, float cost);
+
+private:
+    // Métodos auxiliares
+    bool contains(const int *sortedSolution, int solutionSize);
+    int worstIndex();
+};
+
+#endif // ELITEPOOL_H_INCLUDED
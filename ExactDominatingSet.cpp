@@ -0,0 +1,523 @@
+#include "ExactDominatingSet.h"
+#include "thread/parallel.h"
+#include "time/util.h"
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstring>
+
+using namespace std;
+
+// Quantidade de entradas (potência de 2) da tabela de subproblemas de cada thread
+static const int MEMO_SIZE = 1 << 16;
+// Intervalo, em nós da árvore, entre as verificações dos critérios de parada
+static const int CHECK_INTERVAL = 1024;
+
+/**************************************************************************************************
+ * Defining the ExactDominatingSet's methods
+ **************************************************************************************************/
+
+/****************
+ * Funcao    : ExactDominatingSet(Graph *graph)                                                   *
+ * Descricao : Prepara as vizinhanças fechadas em bits, como linhas densas, e, em grafos           *
+ *             direcionados, as linhas de quem cobre cada nó (transposta das vizinhanças)         *
+ * Parametros: graph - grafo do problema                                                          *
+ ***************/
+ExactDominatingSet::ExactDominatingSet(Graph *graph)
+{
+    this->graph = graph;
+    this->nodeList = graph->copyNodePointersToArray(&this->size);
+    this->weights = new float[this->size > 0 ? this->size : 1];
+    this->integralWeights = true;
+    for (int i = 0; i < this->size; i++)
+    {
+        this->weights[i] = this->nodeList[i]->getWeight();
+        if (this->weights[i] != floorf(this->weights[i]))
+            this->integralWeights = false;
+    }
+    this->coverageKernel = new CoverageKernel(graph);
+    this->numWords = this->coverageKernel->getNumberWords();
+
+    // A busca combina conjuntos inteiros palavra a palavra, então as linhas são densas
+    this->neighborhoods = allocBitset((size_t)(this->size > 0 ? this->size : 1) * this->numWords);
+    for (int c = 0; c < this->size; c++)
+        this->coverageKernel->loadNeighborhood(c, this->neighborhoods + (size_t)c * this->numWords);
+
+    this->coverers = nullptr;
+    if (graph->getDirected())
+    {
+        this->coverers = allocBitset((size_t)(this->size > 0 ? this->size : 1) * this->numWords);
+        for (int c = 0; c < this->size; c++)
+        {
+            const uint64_t *neighborhood = this->getNeighborhood(c);
+            for (int u = 0; u < this->size; u++)
+                if (neighborhood[u / 64] & ((uint64_t)1 << (u % 64)))
+                    this->coverers[(size_t)u * this->numWords + c / 64] |= (uint64_t)1 << (c % 64);
+        }
+    }
+
+    this->upperBound.store(FLT_MAX);
+    this->lowerBound = 0;
+    this->optimal = false;
+    this->numberNodes = 0;
+}
+
+// Destrutor
+ExactDominatingSet::~ExactDominatingSet()
+{
+    delete[] this->nodeList;
+    delete[] this->weights;
+    delete this->coverageKernel;
+    freeBitset(this->neighborhoods);
+    if (this->coverers != nullptr)
+        freeBitset(this->coverers);
+    this->nodeList = nullptr;
+    this->weights = nullptr;
+    this->coverageKernel = nullptr;
+    this->neighborhoods = this->coverers = nullptr;
+    this->graph = nullptr;
+    this->size = 0;
+}
+
+// Getters
+float ExactDominatingSet::getLowerBound()
+{
+    return this->lowerBound;
+}
+bool ExactDominatingSet::isOptimal()
+{
+    return this->optimal;
+}
+long long ExactDominatingSet::getNumberNodes()
+{
+    return this->numberNodes;
+}
+
+// Métodos de manipulação
+//
+
+/****************
+ * Funcao    : list<SimpleNode> solve(float *totalCost, int numThreads, StoppingCriteria *stoppingCriteria)          *
+ * Descricao : Resolve o problema por branch-and-bound. O limite superior inicial é a melhor solução do guloso      *
+ *             de ganho dinâmico e do guloso randomizado; os ramos da raiz são distribuídos entre as threads,      *
+ *             que compartilham o limite superior. Se um critério de parada interromper a busca, o limite         *
+ *             inferior é o menor limite dos subproblemas não resolvidos, e a solução é a melhor encontrada.      *
+ * Parametros: totalCost - custo total da solução                                                                  *
+ *             numThreads - quantidade de threads; valores <= 0 usam todos os núcleos                               *
+ *             stoppingCriteria - critérios de parada (tempo, alvo e cancelamento); nullptr resolve até o fim       *
+ * Retorno   : Retorna uma lista de nós solução.                                                                   *
+ ***************/
+list<SimpleNode> ExactDominatingSet::solve(float *totalCost, int numThreads, StoppingCriteria *stoppingCriteria)
+{
+    numThreads = resolveThreads(numThreads);
+    double startTime = wallClock();
+    atomic<bool> stopped(false);
+
+    // Limite superior das heurísticas
+    float greedyCost = 0, randomizedCost = 0;
+    SearchStatistics statistics;
+    list<SimpleNode> bestSolutionSet = this->graph->dominatingSetWeightedDynamic(&greedyCost);
+    list<SimpleNode> randomizedSolution = this->graph->dominatingSetWeightedRandomized(&randomizedCost, 1, 100, 0.2, numThreads, nullptr, &statistics);
+    if (randomizedCost < greedyCost)
+        bestSolutionSet.swap(randomizedSolution);
+    float initialCost = min(greedyCost, randomizedCost);
+    this->upperBound.store(initialCost);
+
+    BranchWorkspace **workspaces = new BranchWorkspace *[numThreads];
+    for (int t = 0; t < numThreads; t++)
+        workspaces[t] = this->createWorkspace();
+
+    // Raiz: todos os nós descobertos e todos candidatos
+    uint64_t *rootUncovered = workspaces[0]->uncoveredStack;
+    uint64_t *rootAvailable = workspaces[0]->availableStack;
+    this->coverageKernel->resetUncoveredSet(rootUncovered);
+    fillBitset(rootAvailable, this->size, this->numWords);
+    int branchNodeId = -1;
+    float rootBound = this->size > 0 ? this->computeBound(workspaces[0], rootUncovered, rootAvailable, &branchNodeId) : 0;
+    // O limite lagrangiano, mais caro, só vale na raiz; reaproveita o calculado pelo guloso randomizado
+    rootBound = max(rootBound, statistics.lowerBound);
+    int numRootCandidates = 0;
+    int *rootCandidates = new int[this->size > 0 ? this->size : 1];
+    if (branchNodeId != -1 && !this->canPrune(0, rootBound))
+    {
+        numRootCandidates = this->sortCandidates(workspaces[0], rootUncovered, rootAvailable, branchNodeId);
+        memcpy(rootCandidates, workspaces[0]->candidateStack, numRootCandidates * sizeof(int));
+        workspaces[0]->candidateTop = 0;
+    }
+
+    // Cada ramo da raiz escolhe um candidato e exclui os anteriores
+    parallelFor(numRootCandidates, numThreads, [&](int i, int thread)
+                {
+        BranchWorkspace *workspace = workspaces[thread];
+        if (stopped.load(memory_order_relaxed))
+        {
+            workspace->openBound = min(workspace->openBound, rootBound);
+            return;
+        }
+        uint64_t *uncovered = workspace->uncoveredStack + this->numWords;
+        uint64_t *available = workspace->availableStack + this->numWords;
+        const uint64_t *neighborhood = this->getNeighborhood(rootCandidates[i]);
+        for (int w = 0; w < this->numWords; w++)
+        {
+            uncovered[w] = rootUncovered[w] & ~neighborhood[w];
+            available[w] = rootAvailable[w];
+        }
+        for (int j = 0; j <= i; j++)
+            available[rootCandidates[j] / 64] &= ~((uint64_t)1 << (rootCandidates[j] % 64));
+        workspace->solution[0] = rootCandidates[i];
+        workspace->solutionSize = 1;
+        this->search(workspace, 1, this->weights[rootCandidates[i]], stoppingCriteria, startTime, &stopped); });
+
+    // Melhor solução entre as threads
+    int bestThread = -1;
+    float openBound = FLT_MAX;
+    this->numberNodes = 0;
+    for (int t = 0; t < numThreads; t++)
+    {
+        if (workspaces[t]->bestCost < initialCost && (bestThread == -1 || workspaces[t]->bestCost < workspaces[bestThread]->bestCost))
+            bestThread = t;
+        openBound = min(openBound, workspaces[t]->openBound);
+        this->numberNodes += workspaces[t]->numberNodes;
+    }
+    if (bestThread != -1)
+    {
+        bestSolutionSet.clear();
+        for (int i = 0; i < workspaces[bestThread]->bestSolutionSize; i++)
+        {
+            Node *node = this->nodeList[workspaces[bestThread]->bestSolution[i]];
+            SimpleNode simpleNode;
+            simpleNode.id = node->getId();
+            simpleNode.label = node->getLabel();
+            simpleNode.degree = node->getInDegree();
+            simpleNode.weight = node->getWeight();
+            bestSolutionSet.emplace_back(simpleNode);
+        }
+    }
+    *totalCost = 0;
+    for (auto &&node : bestSolutionSet)
+        *totalCost += node.weight;
+
+    // Limite inferior comprovado
+    if (stopped.load())
+    {
+        this->lowerBound = max(rootBound, min(*totalCost, openBound));
+        if (this->integralWeights)
+            this->lowerBound = ceilf(this->lowerBound - 1e-3f);
+        this->optimal = this->lowerBound >= *totalCost - 1e-4f;
+    }
+    else
+    {
+        this->lowerBound = *totalCost;
+        this->optimal = true;
+    }
+
+    // Limpa a memória
+    for (int t = 0; t < numThreads; t++)
+        this->deleteWorkspace(workspaces[t]);
+    delete[] workspaces;
+    delete[] rootCandidates;
+
+    return bestSolutionSet;
+}
+
+// Métodos auxiliares
+//
+
+// Vizinhança fechada de um nó, como linha densa
+const uint64_t *ExactDominatingSet::getNeighborhood(int nodeId)
+{
+    return this->neighborhoods + (size_t)nodeId * this->numWords;
+}
+
+// Nós que cobrem um nó: a própria vizinhança fechada em grafos não direcionados
+const uint64_t *ExactDominatingSet::getCoverers(int nodeId)
+{
+    if (this->coverers == nullptr)
+        return this->getNeighborhood(nodeId);
+    return this->coverers + (size_t)nodeId * this->numWords;
+}
+
+BranchWorkspace *ExactDominatingSet::createWorkspace()
+{
+    int size = this->size > 0 ? this->size : 1;
+    BranchWorkspace *workspace = new BranchWorkspace;
+    workspace->uncoveredStack = allocBitset((size_t)(size + 1) * this->numWords);
+    workspace->availableStack = allocBitset((size_t)(size + 1) * this->numWords);
+    workspace->blocked = allocBitset(this->numWords);
+    workspace->candidateStack = new int[size];
+    workspace->candidateCapacity = size;
+    workspace->candidateTop = 0;
+    workspace->counts = new int[size];
+    workspace->prices = new float[size];
+    workspace->minWeights = new float[size];
+    workspace->solution = new int[size];
+    workspace->solutionSize = 0;
+    workspace->bestSolution = new int[size];
+    workspace->bestSolutionSize = 0;
+    workspace->bestCost = FLT_MAX;
+    workspace->memo = new MemoEntry[MEMO_SIZE];
+    for (int i = 0; i < MEMO_SIZE; i++)
+    {
+        workspace->memo[i].key = 0;
+        workspace->memo[i].cost = FLT_MAX;
+    }
+    workspace->openBound = FLT_MAX;
+    workspace->numberNodes = 0;
+    return workspace;
+}
+
+void ExactDominatingSet::deleteWorkspace(BranchWorkspace *workspace)
+{
+    freeBitset(workspace->uncoveredStack);
+    freeBitset(workspace->availableStack);
+    freeBitset(workspace->blocked);
+    delete[] workspace->candidateStack;
+    delete[] workspace->counts;
+    delete[] workspace->prices;
+    delete[] workspace->minWeights;
+    delete[] workspace->solution;
+    delete[] workspace->bestSolution;
+    delete[] workspace->memo;
+    delete workspace;
+}
+
+/****************
+ * Funcao    : float computeBound(BranchWorkspace *workspace, const uint64_t *uncovered, const uint64_t *available, int *branchNodeId)*
+ * Descricao : Calcula um limite inferior para cobrir os nós descobertos com os candidatos disponíveis, o maior entre:        *
+ *             - a relaxação fracionária: cada nó descoberto paga ao menos o menor custo por nó coberto (peso/ganho)         *
+ *               dos candidatos que o cobrem;                                                                               *
+ *             - um empacotamento de nós descobertos sem candidatos em comum, cada um pagando o seu candidato mais leve.    *
+ *             Escolhe também o nó descoberto com menos candidatos para a ramificação.                                      *
+ * Parametros: workspace - área de trabalho da thread                                                                       *
+ *             uncovered - nós descobertos                                                                                  *
+ *             available - candidatos disponíveis                                                                          *
+ *             branchNodeId - endereço do nó escolhido para a ramificação                                                   *
+ * Retorno   : Retorna o limite inferior, ou FLT_MAX se algum nó descoberto não tem candidato.                               *
+ ***************/
+float ExactDominatingSet::computeBound(BranchWorkspace *workspace, const uint64_t *uncovered, const uint64_t *available, int *branchNodeId)
+{
+    int *counts = workspace->counts;
+    float *prices = workspace->prices;
+    float *minWeights = workspace->minWeights;
+    for (int w = 0; w < this->numWords; w++)
+        for (uint64_t bits = uncovered[w]; bits != 0; bits &= bits - 1)
+        {
+            int u = w * 64 + __builtin_ctzll(bits);
+            counts[u] = 0;
+            prices[u] = minWeights[u] = FLT_MAX;
+        }
+
+    // Relaxação fracionária
+    for (int w = 0; w < this->numWords; w++)
+        for (uint64_t bits = available[w]; bits != 0; bits &= bits - 1)
+        {
+            int c = w * 64 + __builtin_ctzll(bits);
+            const uint64_t *neighborhood = this->getNeighborhood(c);
+            int gain = popcountAnd(neighborhood, uncovered, this->numWords);
+            if (gain == 0)
+                continue;
+            float ratio = this->weights[c] / gain;
+            for (int x = 0; x < this->numWords; x++)
+                for (uint64_t covered = neighborhood[x] & uncovered[x]; covered != 0; covered &= covered - 1)
+                {
+                    int u = x * 64 + __builtin_ctzll(covered);
+                    counts[u]++;
+                    prices[u] = min(prices[u], ratio);
+                    minWeights[u] = min(minWeights[u], this->weights[c]);
+                }
+        }
+
+    float fractionalBound = 0;
+    *branchNodeId = -1;
+    for (int w = 0; w < this->numWords; w++)
+        for (uint64_t bits = uncovered[w]; bits != 0; bits &= bits - 1)
+        {
+            int u = w * 64 + __builtin_ctzll(bits);
+            if (counts[u] == 0)
+                return FLT_MAX;
+            fractionalBound += prices[u];
+            if (*branchNodeId == -1 || counts[u] < counts[*branchNodeId])
+                *branchNodeId = u;
+        }
+
+    // Empacotamento de nós com conjuntos de candidatos disjuntos
+    float packingBound = 0;
+    uint64_t *blocked = workspace->blocked;
+    memset(blocked, 0, this->numWords * sizeof(uint64_t));
+    for (int w = 0; w < this->numWords; w++)
+        for (uint64_t bits = uncovered[w]; bits != 0; bits &= bits - 1)
+        {
+            int u = w * 64 + __builtin_ctzll(bits);
+            const uint64_t *coverers = this->getCoverers(u);
+            bool disjoint = true;
+            for (int x = 0; x < this->numWords && disjoint; x++)
+                disjoint = (coverers[x] & available[x] & blocked[x]) == 0;
+            if (!disjoint)
+                continue;
+            packingBound += minWeights[u];
+            for (int x = 0; x < this->numWords; x++)
+                blocked[x] |= coverers[x] & available[x];
+        }
+
+    return max(fractionalBound, packingBound);
+}
+
+/****************
+ * Funcao    : int sortCandidates(BranchWorkspace *workspace, const uint64_t *uncovered, const uint64_t *available, int branchNodeId)*
+ * Descricao : Empilha, a partir do topo da pilha de candidatos, os candidatos que cobrem o nó da ramificação, do menor  *
+ *             para o maior custo por nó descoberto coberto; quem chama desempilha ao terminar o nível                  *
+ * Parametros: workspace - área de trabalho da thread                                                                   *
+ *             uncovered - nós descobertos                                                                              *
+ *             available - candidatos disponíveis                                                                      *
+ *             branchNodeId - nó escolhido para a ramificação                                                           *
+ * Retorno   : Retorna a quantidade de candidatos.                                                                      *
+ ***************/
+int ExactDominatingSet::sortCandidates(BranchWorkspace *workspace, const uint64_t *uncovered, const uint64_t *available, int branchNodeId)
+{
+    float *ratios = workspace->prices;
+    const uint64_t *coverers = this->getCoverers(branchNodeId);
+    size_t requiredCapacity = workspace->candidateTop + popcountAnd(coverers, available, this->numWords);
+    if (requiredCapacity > workspace->candidateCapacity)
+        this->growCandidateStack(workspace, requiredCapacity);
+    int *candidates = workspace->candidateStack + workspace->candidateTop;
+    int numCandidates = 0;
+    for (int w = 0; w < this->numWords; w++)
+        for (uint64_t bits = coverers[w] & available[w]; bits != 0; bits &= bits - 1)
+        {
+            int c = w * 64 + __builtin_ctzll(bits);
+            ratios[c] = this->weights[c] / popcountAnd(this->getNeighborhood(c), uncovered, this->numWords);
+            candidates[numCandidates++] = c;
+        }
+    sort(candidates, candidates + numCandidates, [ratios](int first, int second)
+         { return ratios[first] != ratios[second] ? ratios[first] < ratios[second] : first < second; });
+    workspace->candidateTop += numCandidates;
+    return numCandidates;
+}
+
+// Aumenta a pilha de candidatos, ao menos dobrando-a, e preserva os níveis já empilhados
+void ExactDominatingSet::growCandidateStack(BranchWorkspace *workspace, size_t minimumCapacity)
+{
+    size_t capacity = max(2 * workspace->candidateCapacity, minimumCapacity);
+    int *candidateStack = new int[capacity];
+    memcpy(candidateStack, workspace->candidateStack, workspace->candidateTop * sizeof(int));
+    delete[] workspace->candidateStack;
+    workspace->candidateStack = candidateStack;
+    workspace->candidateCapacity = capacity;
+}
+
+// Verifica se um subproblema não pode melhorar o limite superior; com pesos inteiros, o limite é arredondado para cima
+bool ExactDominatingSet::canPrune(float cost, float bound)
+{
+    if (bound == FLT_MAX)
+        return true;
+    float upperBound = this->upperBound.load(memory_order_relaxed);
+    if (this->integralWeights)
+        return ceilf(cost + bound - 1e-3f) >= upperBound - 1e-3f;
+    return cost + bound >= upperBound - 1e-4f;
+}
+
+bool ExactDominatingSet::stopRequested(StoppingCriteria *stoppingCriteria, double startTime, atomic<bool> *stopped)
+{
+    if (stopped->load(memory_order_relaxed))
+        return true;
+    if (stoppingCriteria == nullptr)
+        return false;
+    bool stop = (stoppingCriteria->cancelled != nullptr && stoppingCriteria->cancelled->load(memory_order_relaxed)) ||
+                (stoppingCriteria->timeLimit > 0 && wallClock() - startTime >= stoppingCriteria->timeLimit) ||
+                (stoppingCriteria->targetCost >= 0 && this->upperBound.load(memory_order_relaxed) <= stoppingCriteria->targetCost);
+    if (stop)
+        stopped->store(true, memory_order_relaxed);
+    return stop;
+}
+
+/****************
+ * Funcao    : void search(BranchWorkspace *workspace, int depth, float cost, StoppingCriteria *stoppingCriteria, double startTime, atomic<bool> *stopped)*
+ * Descricao : Explora em profundidade o subproblema cujos conjuntos estão na posição depth das pilhas. Subproblemas     *
+ *             repetidos (mesmos descobertos e candidatos) com custo maior ou igual são podados pela tabela da thread.    *
+ * Parametros: workspace - área de trabalho da thread                                                                   *
+ *             depth - profundidade do subproblema                                                                     *
+ *             cost - custo dos nós já escolhidos                                                                      *
+ *             stoppingCriteria - critérios de parada                                                                  *
+ *             startTime - instante de início da resolução (wallClock)                                                 *
+ *             stopped - sinal compartilhado de interrupção da busca                                                   *
+ * Retorno   : Sem retorno.                                                                                            *
+ ***************/
+void ExactDominatingSet::search(BranchWorkspace *workspace, int depth, float cost, StoppingCriteria *stoppingCriteria, double startTime, atomic<bool> *stopped)
+{
+    workspace->numberNodes++;
+    if (stopped->load(memory_order_relaxed) ||
+        (workspace->numberNodes % CHECK_INTERVAL == 0 && this->stopRequested(stoppingCriteria, startTime, stopped)))
+    {
+        workspace->openBound = min(workspace->openBound, cost);
+        return;
+    }
+
+    uint64_t *uncovered = workspace->uncoveredStack + (size_t)depth * this->numWords;
+    uint64_t *available = workspace->availableStack + (size_t)depth * this->numWords;
+    if (popcountBitset(uncovered, this->numWords) == 0)
+    {
+        if (cost < workspace->bestCost)
+        {
+            workspace->bestCost = cost;
+            workspace->bestSolutionSize = workspace->solutionSize;
+            memcpy(workspace->bestSolution, workspace->solution, workspace->solutionSize * sizeof(int));
+            this->updateUpperBound(cost);
+        }
+        return;
+    }
+
+    // Subproblema já visitado com custo menor ou igual
+    uint64_t key = 0x9E3779B97F4A7C15ULL;
+    for (int w = 0; w < this->numWords; w++)
+    {
+        key = (key ^ uncovered[w]) * 0xBF58476D1CE4E5B9ULL;
+        key = (key ^ available[w] ^ (key >> 29)) * 0x94D049BB133111EBULL;
+    }
+    MemoEntry *entry = &workspace->memo[key & (MEMO_SIZE - 1)];
+    if (entry->key == key && entry->cost <= cost)
+        return;
+    entry->key = key;
+    entry->cost = cost;
+
+    int branchNodeId;
+    float bound = this->computeBound(workspace, uncovered, available, &branchNodeId);
+    if (this->canPrune(cost, bound))
+        return;
+
+    // Cada filho escolhe um candidato e exclui os anteriores; os filhos empilham acima deste nível, e a pilha
+    // pode ser realocada, então os candidatos são lidos pela posição do nível
+    size_t candidateBase = workspace->candidateTop;
+    int numCandidates = this->sortCandidates(workspace, uncovered, available, branchNodeId);
+    uint64_t *nextUncovered = uncovered + this->numWords;
+    uint64_t *nextAvailable = available + this->numWords;
+    memcpy(nextAvailable, available, this->numWords * sizeof(uint64_t));
+    for (int i = 0; i < numCandidates; i++)
+    {
+        int candidateId = workspace->candidateStack[candidateBase + i];
+        const uint64_t *neighborhood = this->getNeighborhood(candidateId);
+        for (int w = 0; w < this->numWords; w++)
+            nextUncovered[w] = uncovered[w] & ~neighborhood[w];
+        nextAvailable[candidateId / 64] &= ~((uint64_t)1 << (candidateId % 64));
+
+        workspace->solution[workspace->solutionSize++] = candidateId;
+        this->search(workspace, depth + 1, cost + this->weights[candidateId], stoppingCriteria, startTime, stopped);
+        workspace->solutionSize--;
+
+        if (stopped->load(memory_order_relaxed))
+        {
+            workspace->openBound = min(workspace->openBound, cost + bound);
+            break;
+        }
+        if (this->canPrune(cost, bound))
+            break;
+    }
+    workspace->candidateTop = candidateBase;
+}
+
+// Atualiza, sem trava, o limite superior compartilhado entre as threads
+void ExactDominatingSet::updateUpperBound(float cost)
+{
+    float current = this->upperBound.load();
+    while (cost < current && !this->upperBound.compare_exchange_weak(current, cost))
+        ;
+}
@@ -0,0 +1,96 @@
+/**************************************************************************************************
+ * Implementation of the TAD ExactDominatingSet
+ **************************************************************************************************/
+
+#ifndef EXACTDOMINATINGSET_H_INCLUDED
+#define EXACTDOMINATINGSET_H_INCLUDED
+#include "Graph.h"
+#include "CoverageKernel.h"
+#include <atomic>
+#include <list>
+
+using namespace std;
+
+// Entrada da tabela de subproblemas já visitados por uma thread
+typedef struct
+{
+    uint64_t key;
+    float cost;
+} MemoEntry;
+
+// Área de trabalho de uma thread do branch-and-bound: pilhas de conjuntos por profundidade, pilha de
+// candidatos (cada nível ocupa só os seus, a partir do topo, e ela cresce sob demanda), solução parcial,
+// melhor solução da thread e tabela de subproblemas
+typedef struct
+{
+    uint64_t *uncoveredStack;
+    uint64_t *availableStack;
+    uint64_t *blocked;
+    int *candidateStack;
+    size_t candidateCapacity;
+    size_t candidateTop;
+    int *counts;
+    float *prices;
+    float *minWeights;
+    int *solution;
+    int solutionSize;
+    int *bestSolution;
+    int bestSolutionSize;
+    float bestCost;
+    MemoEntry *memo;
+    float openBound;
+    long long numberNodes;
+} BranchWorkspace;
+
+// Solução exata do conjunto dominante ponderado por branch-and-bound sobre conjuntos de bits: a
+// ramificação escolhe o nó descoberto com menos candidatos e tenta cada candidato que o cobre, com
+// limites superiores das heurísticas e limites inferiores de relaxações da cobertura
+class ExactDominatingSet
+{
+    // Atributos
+private:
+    int size;
+    int numWords;
+    Graph *graph;
+    Node **nodeList;
+    float *weights;
+    bool integralWeights;
+    CoverageKernel *coverageKernel;
+    uint64_t *neighborhoods;
+    uint64_t *coverers;
+    atomic<float> upperBound;
+    float lowerBound;
+    bool optimal;
+    long long numberNodes;
+
+public:
+    // Construtor
+    ExactDominatingSet(Graph *graph);
+
+    // Destrutor
+    ~ExactDominatingSet();
+
+    // Getters
+    float getLowerBound();
+    bool isOptimal();
+    long long getNumberNodes();
+
+    // Métodos de manipulação
+    list<SimpleNode> solve(float *totalCost, int numThreads, StoppingCriteria *stoppingCriteria);
+
+private:
+    // Métodos auxiliares
+    const uint64_t *getNeighborhood(int nodeId);
+    const uint64_t *getCoverers(int nodeId);
+    BranchWorkspace *createWorkspace();
+    void deleteWorkspace(BranchWorkspace *workspace);
+    float computeBound(BranchWorkspace *workspace, const uint64_t *uncovered, const uint64_t *available, int *branchNodeId);
+    int sortCandidates(BranchWorkspace *workspace, const uint64_t *uncovered, const uint64_t *available, int branchNodeId);
+    void growCandidateStack(BranchWorkspace *workspace, size_t minimumCapacity);
+    bool canPrune(float cost, float bound);
+    bool stopRequested(StoppingCriteria *stoppingCriteria, double startTime, atomic<bool> *stopped);
+    void search(BranchWorkspace *workspace, int depth, float cost, StoppingCriteria *stoppingCriteria, double startTime, atomic<bool> *stopped);
+    void updateUpperBound(float cost);
+};
+
+#endif // EXACTDOMINATINGSET_H_INCLUDED
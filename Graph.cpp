@@ -1,15 +1,40 @@
 #include "Graph.h"
 #include "Edge.h"
+#include "CompactGraph.h"
+#include "CoverageKernel.h"
+#include "DiskDistanceMatrix.h"
+#include "DisjointSet.h"
+#include "DominatingSetLowerBound.h"
+#include "DynamicMST.h"
+#include "ElitePool.h"
+#include "IteratedGreedy.h"
+#include "SolutionHashSet.h"
+#include "SolverWorkspace.h"
+#include "matrix/matrix.h"
+#include "thread/parallel.h"
+#include "time/util.h"
 #include <math.h>
 #include <cstdlib>
 #include <algorithm>
+#include <atomic>
 #include <climits>
 #include <cfloat>
+#include <cstring>
 #include <fstream>
 #include <list>
 #include <unistd.h>
 using namespace std;
 
+// Constantes
+// Peso do Dijkstra por nó na escolha do algoritmo de caminhos mínimos entre todos os pares
+static const double APSP_DENSE_FACTOR = 8;
+// Varreduras de subgradiente do limite inferior do conjunto dominante
+static const int LOWER_BOUND_SWEEPS = 200;
+// Iterações em que um nó retirado pelo guloso iterado fica tabu, por nó retirado
+static const int TABU_TENURE_FACTOR = 2;
+// Iterações por bloco do guloso randomizado; as construções repetidas são resolvidas ao fim de cada bloco
+static const int RANDOMIZED_BLOCK = 128;
+
 /**************************************************************************************************
  * Defining the Graph's methods
  **************************************************************************************************/
@@ -24,6 +49,7 @@ Graph::Graph(int order, bool directed, bool weightedEdge, bool weightedNode)
     this->firstNode = this->lastNode = nullptr;
     this->numberEdges = 0;
     this->nodeIdCounter = 0;
+    this->dynamicMST = nullptr;
 }
 
 // Destrutor
@@ -43,6 +69,8 @@ Graph::~Graph()
     this->nodeIdCounter = 0;
     this->firstNode = nullptr;
     this->lastNode = nullptr;
+    delete this->dynamicMST;
+    this->dynamicMST = nullptr;
 }
 
 // Getters
@@ -78,6 +106,10 @@ Node *Graph::getLastNode()
 {
     return this->lastNode;
 }
+DynamicMST *Graph::getDynamicMST()
+{
+    return this->dynamicMST;
+}
 
 // Métodos de manipulação
 //
@@ -177,6 +209,8 @@ void Graph::insertEdge(int sourceLabel, int targetLabel, float weight, Node **so
             (*sourceNode)->incrementInDegree();
             (*targetNode)->incrementOutDegree();
         }
+        if (this->dynamicMST != nullptr)
+            this->notifyDynamicMST(*sourceNode, *targetNode, weight);
     }
 
     (*sourceNode)->incrementOutDegree();
@@ -222,6 +256,8 @@ void Graph::insertEdge(Node *sourceNode, Node *targetNode, float weight)
             sourceNode->incrementInDegree();
             targetNode->incrementOutDegree();
         }
+        if (this->dynamicMST != nullptr)
+            this->notifyDynamicMST(sourceNode, targetNode, weight);
     }
 
     sourceNode->incrementOutDegree();
@@ -447,69 +483,143 @@ float Graph::getWeightBetweenNodes(int sourceId, int targetId)
 //
 
 /****************
- * Funcao    : float floydMarshall()                                             *
- * Descricao : Encontrar o caminho minimo entre todos  os pares de nós do grafo  *
- * Parametros: Sem parametros                                                    *
- * Retorno   : Uma matriz com os valores do caminho minimo entre cada par de nós *
+ * Funcao    : float createDistanceMatrix(int *stride)                                                *
+ * Descricao : Cria a matriz de distâncias sem intermediários, percorrendo cada aresta uma vez         *
+ * Parametros: stride - endereço que guardará a distância, em floats, entre duas linhas da matriz     *
+ * Retorno   : Matriz alocada por allocMatrix, com o peso da aresta (ou FLT_MAX) entre cada par de nós *
  ***************/
-float **Graph::floydMarshall()
+float **Graph::createDistanceMatrix(int *stride)
 {
-    float **minPathCurrent = new float *[this->order];
-    float minPathPrevious[this->order][this->order];
-
-    // Calcula distâncias entre todos os nós sem intermediários
-    for (int i = 0; i < this->order; i++)
+    float **minPath = allocMatrix(this->order, stride);
+    for (Node *n = this->firstNode; n != nullptr; n = n->getNextNode())
     {
-        for (int j = 0; j < this->order; j++)
+        float *row = minPath[n->getId()];
+        for (Edge *e = n->getFirstEdge(); e != nullptr; e = e->getNextEdge())
         {
-            minPathCurrent[i] = new float[this->order];
-            minPathPrevious[i][j] = this->getWeightBetweenNodes(i, j);
+            int targetId = e->getTargetId();
+            if (targetId != n->getId() && e->getWeight() < row[targetId])
+                row[targetId] = e->getWeight();
         }
     }
+    return minPath;
+}
+
+/****************
+ * Funcao    : float floydMarshall()                                                                 *
+ * Descricao : Encontrar o caminho minimo entre todos  os pares de nós do grafo, com o Floyd-Warshall  *
+ *             em blocos sobre uma única matriz contígua e alinhada                                    *
+ * Parametros: Sem parametros                                                                        *
+ * Retorno   : Uma matriz com os valores do caminho minimo entre cada par de nós, a ser liberada com   *
+ *             freeMatrix (as linhas apontam para o mesmo bloco de memória)                            *
+ ***************/
+float **Graph::floydMarshall()
+{
+    int stride;
+    float **minPath = this->createDistanceMatrix(&stride);
+    floydWarshallBlocked(minPath, this->order, stride, 1);
+    return minPath;
+}
 
-    for (int k = 0; k < this->order; k++)
+/****************
+ * Funcao    : float allPairsShortestPaths(int numThreads)                                                      *
+ * Descricao : Calcula o caminho mínimo entre todos os pares de nós escolhendo o algoritmo pela densidade:     *
+ *             Floyd-Warshall em blocos paralelo para grafos densos, ou um Dijkstra com heap a partir de cada  *
+ *             nó, distribuídos entre as threads, para grafos esparsos. Havendo arestas negativas, o Dijkstra  *
+ *             usa a repesagem de Johnson.                                                                     *
+ * Parametros: numThreads - quantidade de threads; valores <= 0 usam todos os núcleos                         *
+ * Retorno   : Matriz de caminhos mínimos, a ser liberada com freeMatrix, ou nullptr se há ciclo negativo      *
+ ***************/
+float **Graph::allPairsShortestPaths(int numThreads)
+{
+    numThreads = resolveThreads(numThreads);
+    CompactGraph *compactGraph = new CompactGraph(this, false);
+    int size = this->order;
+
+    // Custo estimado: n³ do Floyd-Warshall (vetorizado) contra n·(m + n)·log n dos Dijkstras
+    double logSize = size > 2 ? log2((double)size) : 1;
+    double dijkstraCost = APSP_DENSE_FACTOR * ((double)compactGraph->getNumberEdges() + size) * logSize;
+    bool dense = (double)size * size <= dijkstraCost;
+
+    int stride;
+    float **minPath = nullptr;
+    if (dense)
     {
-        for (int i = 0; i < this->order; i++)
-        {
-            for (int j = 0; j < this->order; j++)
+        minPath = this->createDistanceMatrix(&stride);
+        floydWarshallBlocked(minPath, size, stride, numThreads);
+        for (int i = 0; i < size; i++)
+            if (minPath[i][i] < 0)
             {
-                // Verifica se é melhor usar o nó K como intermediário
-                float previousPath = minPathPrevious[i][j];
-                float pathUsingK = minPathPrevious[i][k] + minPathPrevious[k][j];
-                minPathCurrent[i][j] = min(previousPath, pathUsingK);
+                cout << "ERRO: O grafo possui ciclo negativo!";
+                freeMatrix(minPath);
+                minPath = nullptr;
+                break;
             }
+    }
+    else
+    {
+        float *potentials = nullptr;
+        bool valid = true;
+        if (compactGraph->hasNegativeEdge())
+        {
+            potentials = new float[size];
+            valid = compactGraph->computePotentials(potentials);
         }
 
-        // Copia a matriz atual para a anterior
-        for (int i = 0; i < this->order; i++)
-            for (int j = 0; j < this->order; j++)
-                minPathPrevious[i][j] = minPathCurrent[i][j];
+        if (valid)
+        {
+            minPath = allocMatrix(size, &stride);
+            IndexedHeap **heaps = new IndexedHeap *[numThreads];
+            for (int t = 0; t < numThreads; t++)
+                heaps[t] = new IndexedHeap(size);
 
-        // // Impressão de cada iteração
-        // for (int i = 0; i < this->getOrder(); i++)
-        // {
-        //     for (int j = 0; j < this->getOrder(); j++)
-        //     {
-        //         float path = minPathCurrent[i][j];
-        //         string formatedFloat = "";
-        //         if (path == FLT_MAX)
-        //             formatedFloat += "   &";
-        //         else
-        //         {
-        //             if (path < 10)
-        //                 formatedFloat += "0";
-        //             std::stringstream stream;
-        //             stream << std::fixed << std::setprecision(1) << path;
-        //             formatedFloat += stream.str();
-        //         }
-        //         cout << formatedFloat << " ";
-        //     }
-        //     cout << endl;
-        // }
-        // cout << endl;
+            parallelFor(size, numThreads, [&](int sourceId, int thread)
+                        { compactGraph->shortestPaths(sourceId, minPath[sourceId], heaps[thread], potentials); });
+
+            for (int t = 0; t < numThreads; t++)
+                delete heaps[t];
+            delete[] heaps;
+        }
+        else
+            cout << "ERRO: O grafo possui ciclo negativo!";
+
+        delete[] potentials;
+    }
+
+    delete compactGraph;
+    return minPath;
+}
+
+/****************
+ * Funcao    : DiskDistanceMatrix allPairsShortestPathsOnDisk(string path, size_t memoryBudget, int numThreads)   *
+ * Descricao : Calcula o caminho mínimo entre todos os pares de nós com a matriz mantida em um arquivo mapeado  *
+ *             em memória, processada em tiles dimensionados pelo orçamento de memória, para grafos cuja        *
+ *             matriz de distâncias não cabe na RAM                                                             *
+ * Parametros: path - caminho do arquivo de apoio                                                              *
+ *             memoryBudget - memória, em bytes, que a computação pode manter residente                        *
+ *             numThreads - quantidade de threads; valores <= 0 usam todos os núcleos                          *
+ * Retorno   : Matriz em disco para consultas por linha ou por par, ou nullptr em caso de erro                 *
+ ***************/
+DiskDistanceMatrix *Graph::allPairsShortestPathsOnDisk(string path, size_t memoryBudget, int numThreads)
+{
+    DiskDistanceMatrix *minPath = new DiskDistanceMatrix(this->order, path, memoryBudget);
+    if (!minPath->isOpen())
+    {
+        cout << "ERRO: Não foi possível criar o arquivo " << path << "!";
+        delete minPath;
+        return nullptr;
     }
 
-    return minPathCurrent;
+    CompactGraph *compactGraph = new CompactGraph(this, false);
+    bool valid = minPath->compute(compactGraph, resolveThreads(numThreads));
+    delete compactGraph;
+
+    if (!valid)
+    {
+        cout << "ERRO: O grafo possui ciclo negativo!";
+        delete minPath;
+        return nullptr;
+    }
+    return minPath;
 }
 
 /****************
@@ -645,90 +755,160 @@ float *Graph::dijkstra(int startId)
 }
 
 /****************
- * Funcao    : Graph kruskal()                                                          *
- * Descricao : Encontra uma Arvore Geradora Mínima utilizando o algoritmo de Kruskal.   *
- * Parametros: Sem parâmetros.                                                          *
- * Retorno   : Retorna a AGM solução.                                                   *
+ * Funcao    : SimpleEdge createEdgeArray(int *numEdges)                                              *
+ * Descricao : Copia as arestas do grafo para um vetor contíguo; em grafos não direcionados, cada      *
+ *             aresta aparece uma única vez (da ponta de menor id para a de maior id)                 *
+ * Parametros: numEdges - endereço que guardará a quantidade de arestas copiadas                      *
+ * Retorno   : Vetor de arestas, a ser liberado com delete[].                                         *
  ***************/
-Graph *Graph::kruskal()
+SimpleEdge *Graph::createEdgeArray(int *numEdges)
 {
-    if (this->directed)
+    int count = 0;
+    for (Node *n = this->firstNode; n != nullptr; n = n->getNextNode())
+        for (Edge *e = n->getFirstEdge(); e != nullptr; e = e->getNextEdge())
+            if (this->directed || e->getSourceId() < e->getTargetId())
+                count++;
+
+    SimpleEdge *edges = new SimpleEdge[count];
+    int i = 0;
+    for (Node *n = this->firstNode; n != nullptr; n = n->getNextNode())
+        for (Edge *e = n->getFirstEdge(); e != nullptr; e = e->getNextEdge())
+            if (this->directed || e->getSourceId() < e->getTargetId())
+            {
+                edges[i].sourceNodeId = e->getSourceId();
+                edges[i].targetNodeId = e->getTargetId();
+                edges[i].sourceNodeLabel = e->getSourceLabel();
+                edges[i].targetNodeLabel = e->getTargetLabel();
+                edges[i].weight = e->getWeight();
+                i++;
+            }
+    *numEdges = count;
+    return edges;
+}
+
+/****************
+ * Funcao    : void sortEdgesByWeight(SimpleEdge *edges, int numEdges, int *sortedOrder)                  *
+ * Descricao : Ordena as arestas pelo peso com radix sort LSD (4 passadas de 8 bits) sobre os bits do     *
+ *             float, transformados para que a ordem dos inteiros sem sinal seja a ordem dos pesos. A     *
+ *             ordenação é estável: empates mantêm a ordem do vetor.                                      *
+ * Parametros: edges - vetor de arestas                                                                  *
+ *             numEdges - quantidade de arestas                                                          *
+ *             sortedOrder - vetor de tamanho numEdges que receberá os índices das arestas em ordem      *
+ * Retorno   : Sem retorno.                                                                              *
+ ***************/
+void Graph::sortEdgesByWeight(SimpleEdge *edges, int numEdges, int *sortedOrder)
+{
+    unsigned int *keys = new unsigned int[numEdges];
+    unsigned int *auxKeys = new unsigned int[numEdges];
+    int *auxOrder = new int[numEdges];
+    for (int i = 0; i < numEdges; i++)
     {
-        cout << "ERRO: Algoritmo de Kruskal nao funciona para grafos direcionados!";
-        return nullptr;
+        unsigned int bits;
+        memcpy(&bits, &edges[i].weight, sizeof(bits));
+        // Negativos: inverte todos os bits; positivos: liga o bit de sinal
+        keys[i] = (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+        sortedOrder[i] = i;
     }
-    if (!this->isConnected())
+
+    for (int shift = 0; shift < 32; shift += 8)
     {
-        cout << "ERRO: Algoritmo de Kruskal nao funciona para grafos nao conexos!";
-        return nullptr;
+        int counts[257] = {0};
+        for (int i = 0; i < numEdges; i++)
+            counts[((keys[i] >> shift) & 0xFF) + 1]++;
+        for (int d = 0; d < 256; d++)
+            counts[d + 1] += counts[d];
+        for (int i = 0; i < numEdges; i++)
+        {
+            int position = counts[(keys[i] >> shift) & 0xFF]++;
+            auxKeys[position] = keys[i];
+            auxOrder[position] = sortedOrder[i];
+        }
+        for (int i = 0; i < numEdges; i++)
+        {
+            keys[i] = auxKeys[i];
+            sortedOrder[i] = auxOrder[i];
+        }
     }
 
-    // Copia nós do grafo
-    Graph *solutionGraph = new Graph(INT_MAX, directed, weightedEdge, weightedNode);
-    for (Node *n = firstNode; n != nullptr; n = n->getNextNode())
-        solutionGraph->insertNode(n->getLabel(), n->getWeight());
-    solutionGraph->fixOrder();
-    int *components = new int[this->order];
-    for (int i = 0; i < this->order; i++)
-        components[i] = i;
+    delete[] keys;
+    delete[] auxKeys;
+    delete[] auxOrder;
+}
 
-    // Cria lista de arestas
-    list<SimpleEdge> allEdges;
+/****************
+ * Funcao    : Graph createGraphFromEdges(SimpleEdge *edges, int numEdges)                                *
+ * Descricao : Constrói em lote um grafo com todos os nós deste (mesmos ids, labels e pesos) e as arestas *
+ *             informadas, inserindo cada aresta diretamente pelos ponteiros dos nós                      *
+ * Parametros: edges - vetor de arestas, identificadas pelo id dos nós                                   *
+ *             numEdges - quantidade de arestas                                                          *
+ * Retorno   : Retorna o grafo construído.                                                               *
+ ***************/
+Graph *Graph::createGraphFromEdges(SimpleEdge *edges, int numEdges)
+{
+    Graph *newGraph = new Graph(this->order, this->directed, this->weightedEdge, this->weightedNode);
+    Node **nodes = new Node *[this->order];
     for (Node *n = this->firstNode; n != nullptr; n = n->getNextNode())
-        for (Edge *e = n->getFirstEdge(); e != nullptr; e = e->getNextEdge())
-        {
-            SimpleEdge simpleEdge;
-            simpleEdge.sourceNodeId = e->getSourceId();
-            simpleEdge.targetNodeId = e->getTargetId();
-            simpleEdge.sourceNodeLabel = e->getSourceLabel();
-            simpleEdge.targetNodeLabel = e->getTargetLabel();
-            simpleEdge.weight = e->getWeight();
-            allEdges.emplace_back(simpleEdge);
-        }
-    allEdges.sort([](SimpleEdge const &edge1, SimpleEdge const &edge2)
-                  { return edge1.weight < edge2.weight; });
+        nodes[n->getId()] = newGraph->insertNode(n->getLabel(), n->getWeight());
+    newGraph->fixOrder();
 
-    // Constrói árvore geradora mínima
-    int i = 0;
-    while (i < order - 1 && !allEdges.empty())
+    for (int i = 0; i < numEdges; i++)
+        newGraph->insertEdge(nodes[edges[i].sourceNodeId], nodes[edges[i].targetNodeId], edges[i].weight);
+
+    delete[] nodes;
+    return newGraph;
+}
+
+/****************
+ * Funcao    : Graph kruskal()                                                                  *
+ * Descricao : Encontra uma Arvore Geradora Mínima utilizando o algoritmo de Kruskal, sobre um  *
+ *             vetor de arestas ordenado por radix sort e uma estrutura union-find              *
+ * Parametros: Sem parâmetros.                                                                  *
+ * Retorno   : Retorna a AGM solução.                                                           *
+ ***************/
+Graph *Graph::kruskal()
+{
+    if (this->directed)
     {
-        SimpleEdge currentEdge = allEdges.front();
-        allEdges.pop_front();
+        cout << "ERRO: Algoritmo de Kruskal nao funciona para grafos direcionados!";
+        return nullptr;
+    }
 
-        if (components[currentEdge.sourceNodeId] != components[currentEdge.targetNodeId])
-        {
-            solutionGraph->insertEdge(currentEdge.sourceNodeLabel, currentEdge.targetNodeLabel, currentEdge.weight);
-            if (components[currentEdge.sourceNodeId] > components[currentEdge.targetNodeId])
-            {
-                int oldComponent = components[currentEdge.sourceNodeId];
-                for (int j = 0; j < this->order; j++)
-                    if (components[j] == oldComponent)
-                        components[j] = components[currentEdge.targetNodeId];
-            }
-            else
-            {
-                int oldComponent = components[currentEdge.targetNodeId];
-                for (int j = 0; j < this->order; j++)
-                    if (components[j] == oldComponent)
-                        components[j] = components[currentEdge.sourceNodeId];
-            }
-            i++;
-        }
+    // Cria e ordena vetor de arestas
+    int numEdges;
+    SimpleEdge *allEdges = this->createEdgeArray(&numEdges);
+    int *sortedOrder = new int[numEdges];
+    this->sortEdgesByWeight(allEdges, numEdges, sortedOrder);
 
-        for (int j = 0; j < this->order; j++)
-            cout << components[j] << " ";
-        cout << endl;
+    // Constrói árvore geradora mínima
+    DisjointSet *components = new DisjointSet(this->order);
+    SimpleEdge *solutionEdges = new SimpleEdge[this->order > 0 ? this->order : 1];
+    int numSolutionEdges = 0;
+    for (int i = 0; i < numEdges && numSolutionEdges < this->order - 1; i++)
+    {
+        SimpleEdge currentEdge = allEdges[sortedOrder[i]];
+        if (components->unite(currentEdge.sourceNodeId, currentEdge.targetNodeId))
+            solutionEdges[numSolutionEdges++] = currentEdge;
     }
 
+    Graph *solutionGraph = nullptr;
+    if (numSolutionEdges < this->order - 1)
+        cout << "ERRO: Algoritmo de Kruskal nao funciona para grafos nao conexos!";
+    else
+        solutionGraph = this->createGraphFromEdges(solutionEdges, numSolutionEdges);
+
     delete components;
+    delete[] allEdges;
+    delete[] sortedOrder;
+    delete[] solutionEdges;
     return solutionGraph;
 }
 
 /****************
- * Funcao    : Graph prim()                                                         *
- * Descricao : Encontra uma Arvore Geradora Mínima utilizando o algoritmo de Prim.  *
- * Parametros: Sem parâmetros.                                                      *
- * Retorno   : Retorna a AGM solução.                                               *
+ * Funcao    : Graph prim()                                                                     *
+ * Descricao : Encontra uma Arvore Geradora Mínima utilizando o algoritmo de Prim, com heap     *
+ *             binário indexado sobre a cópia contígua (CSR) das adjacências, em O(E log V)    *
+ * Parametros: Sem parâmetros.                                                                  *
+ * Retorno   : Retorna a AGM solução.                                                           *
  ***************/
 Graph *Graph::prim()
 {
@@ -737,143 +917,321 @@ Graph *Graph::prim()
         cout << "ERRO: Algoritmo de Prim nao funciona para grafos direcionados!";
         return nullptr;
     }
-    if (!this->isConnected())
-    {
-        cout << "ERRO: Algoritmo de Prim nao funciona para grafos nao conexos!";
-        return nullptr;
-    }
 
-    // Cria lista de arestas
-    list<SimpleEdge> allEdges;
-    list<SimpleEdge> solutionEdges;
-    for (Node *n = this->firstNode; n != nullptr; n = n->getNextNode())
-        for (Edge *e = n->getFirstEdge(); e != nullptr; e = e->getNextEdge())
-        {
-            SimpleEdge simpleEdge;
-            simpleEdge.sourceNodeId = e->getSourceId();
-            simpleEdge.targetNodeId = e->getTargetId();
-            simpleEdge.weight = e->getWeight();
-            allEdges.emplace_back(simpleEdge);
-        }
-    SimpleEdge shortestEdge = allEdges.front();
-    for (auto &&e : allEdges)
-    {
-        if (e.weight < shortestEdge.weight)
-            shortestEdge = e;
-    }
+    CompactGraph *compactGraph = new CompactGraph(this, false);
+    int *offsets = compactGraph->getOffsets();
+    int *targets = compactGraph->getTargets();
+    float *edgeWeights = compactGraph->getEdgeWeights();
 
     // Cria listas auxiliares de distância
     int *nearestNodeList = new int[this->order];
-    float *auxNodeList = new float[this->order];
-
-    // Adiciona primeira aresta
-    solutionEdges.emplace_back(shortestEdge);
-    int sourceNodeId = shortestEdge.sourceNodeId;
-    int targetNodeId = shortestEdge.targetNodeId;
-    int k = 0;
-    // Preenche distâncias para nós conectados aos presentes na menor aresta
-    for (Node *n = this->firstNode; n != nullptr && k < this->order; n = n->getNextNode())
+    bool *inSolution = new bool[this->order];
+    for (int i = 0; i < this->order; i++)
+    {
+        nearestNodeList[i] = -1;
+        inSolution[i] = false;
+    }
+    IndexedHeap *heap = new IndexedHeap(this->order);
+    SimpleEdge *solutionEdges = new SimpleEdge[this->order > 0 ? this->order : 1];
+    int numSolutionEdges = 0;
+
+    // Seleção das arestas a partir do primeiro nó
+    if (this->order > 0)
+        heap->push(0, 0);
+    while (!heap->isEmpty())
     {
-        float distanceCurrentToSource = n->distanceToOtherNode(sourceNodeId);
-        float distanceCurrentToTarget = n->distanceToOtherNode(targetNodeId);
-        if (distanceCurrentToSource < distanceCurrentToTarget)
+        float distance = heap->getKey(heap->peek());
+        int currentId = heap->pop();
+        inSolution[currentId] = true;
+        if (nearestNodeList[currentId] != -1)
         {
-            nearestNodeList[k] = sourceNodeId;
-            auxNodeList[k] = distanceCurrentToSource;
+            solutionEdges[numSolutionEdges].sourceNodeId = nearestNodeList[currentId];
+            solutionEdges[numSolutionEdges].targetNodeId = currentId;
+            solutionEdges[numSolutionEdges].weight = distance;
+            numSolutionEdges++;
         }
-        else
+
+        // Atualiza distâncias dos vizinhos fora da solução
+        for (int e = offsets[currentId]; e < offsets[currentId + 1]; e++)
         {
-            nearestNodeList[k] = targetNodeId;
-            auxNodeList[k] = distanceCurrentToTarget;
+            int targetId = targets[e];
+            if (inSolution[targetId])
+                continue;
+            if (!heap->contains(targetId))
+            {
+                nearestNodeList[targetId] = currentId;
+                heap->push(targetId, edgeWeights[e]);
+            }
+            else if (edgeWeights[e] < heap->getKey(targetId))
+            {
+                nearestNodeList[targetId] = currentId;
+                heap->decreaseKey(targetId, edgeWeights[e]);
+            }
         }
-        k++;
     }
-    int static alreadyInSolution = -1;
-    nearestNodeList[sourceNodeId] = alreadyInSolution;
-    nearestNodeList[targetNodeId] = alreadyInSolution;
 
-    // Seleção das arestas
-    for (int i = 0; i < this->order - 2; i++)
+    Graph *solutionGraph = nullptr;
+    if (numSolutionEdges < this->order - 1)
+        cout << "ERRO: Algoritmo de Prim nao funciona para grafos nao conexos!";
+    else
+        solutionGraph = this->createGraphFromEdges(solutionEdges, numSolutionEdges);
+
+    delete compactGraph;
+    delete heap;
+    delete[] nearestNodeList;
+    delete[] inSolution;
+    delete[] solutionEdges;
+    return solutionGraph;
+}
+
+/****************
+ * Funcao    : unsigned long long edgeKey(float weight, int edgeId)                                     *
+ * Descricao : Chave de uma aresta que preserva a ordem (peso, índice): os bits do float são ajustados   *
+ *             para comparar como inteiro sem sinal e ocupam a parte alta, e o índice, a parte baixa      *
+ * Parametros: weight - peso da aresta                                                                  *
+ *             edgeId - índice da aresta                                                                *
+ * Retorno   : Retorna a chave; ULLONG_MAX fica acima de qualquer aresta.                               *
+ ***************/
+static unsigned long long edgeKey(float weight, int edgeId)
+{
+    uint32_t bits;
+    memcpy(&bits, &weight, sizeof(bits));
+    bits = (bits & 0x80000000u) ? ~bits : bits | 0x80000000u;
+    return ((unsigned long long)bits << 32) | (uint32_t)edgeId;
+}
+
+// Guarda em *target o menor entre o valor atual e key
+static void atomicMin(atomic<unsigned long long> *target, unsigned long long key)
+{
+    unsigned long long current = target->load(memory_order_relaxed);
+    while (key < current && !target->compare_exchange_weak(current, key, memory_order_relaxed))
+        ;
+}
+
+/****************
+ * Funcao    : Graph boruvka(int numThreads)                                                              *
+ * Descricao : Encontra uma Floresta Geradora Mínima utilizando o algoritmo de Borůvka. A cada rodada, a  *
+ *             aresta mais leve que sai de cada componente é escolhida por mínimo atômico em um único     *
+ *             vetor indexado pelo componente, com empates decididos pelo índice da aresta. A contração   *
+ *             também é paralela: cada componente aponta para o vizinho da sua aresta (nos pares que se    *
+ *             escolhem mutuamente, o de menor id fica como raiz) e os apontadores são encurtados por     *
+ *             saltos até a raiz. Funciona também para grafos não conexos.                               *
+ * Parametros: numThreads - quantidade de threads; valores <= 0 usam todos os núcleos                     *
+ * Retorno   : Retorna a floresta solução.                                                                *
+ ***************/
+Graph *Graph::boruvka(int numThreads)
+{
+    if (this->directed)
     {
-        // Seleciona id do nó de menor distância
-        int minDistanceSourceId;
-        int m;
-        for (m = 0; m < this->order; m++)
-        {
-            if (nearestNodeList[m] > alreadyInSolution)
+        cout << "ERRO: Algoritmo de Boruvka nao funciona para grafos direcionados!";
+        return nullptr;
+    }
+    numThreads = resolveThreads(numThreads);
+    int size = this->order;
+
+    int numEdges;
+    SimpleEdge *allEdges = this->createEdgeArray(&numEdges);
+    int numActiveEdges = numEdges;
+    int *activeEdges = new int[numEdges > 0 ? numEdges : 1];
+    int *auxActiveEdges = new int[numEdges > 0 ? numEdges : 1];
+    for (int i = 0; i < numEdges; i++)
+        activeEdges[i] = i;
+
+    // Componente de cada nó (id da raiz) e apontadores das raízes durante a contração
+    int *components = new int[size > 0 ? size : 1];
+    int *parents = new int[size > 0 ? size : 1];
+    int *auxParents = new int[size > 0 ? size : 1];
+    for (int v = 0; v < size; v++)
+        components[v] = v;
+    atomic<unsigned long long> *bestKeys = new atomic<unsigned long long>[size > 0 ? size : 1];
+    int *chunkCounts = new int[numThreads + 1];
+    SimpleEdge *solutionEdges = new SimpleEdge[size > 0 ? size : 1];
+    int numSolutionEdges = 0;
+
+    // Divide [0, total) em numThreads faixas contíguas
+    auto chunkBegin = [numThreads](int total, int task)
+    { return (int)((long long)total * task / numThreads); };
+
+    while (true)
+    {
+        // Descarta arestas internas aos componentes, mantendo a ordem
+        parallelFor(numThreads, numThreads, [&](int task, int /*thread*/)
+                    {
+            int count = 0;
+            for (int i = chunkBegin(numActiveEdges, task); i < chunkBegin(numActiveEdges, task + 1); i++)
             {
-                minDistanceSourceId = m;
-                break;
+                SimpleEdge &edge = allEdges[activeEdges[i]];
+                if (components[edge.sourceNodeId] != components[edge.targetNodeId])
+                    count++;
             }
-        }
-        float distanceNodes = 0;
-        for (int n = m + 1; n < this->order; n++)
-        {
-            distanceNodes = auxNodeList[n];
-            if (nearestNodeList[n] > alreadyInSolution && distanceNodes < auxNodeList[minDistanceSourceId])
-                minDistanceSourceId = n;
-        }
+            chunkCounts[task + 1] = count; });
+        chunkCounts[0] = 0;
+        for (int t = 0; t < numThreads; t++)
+            chunkCounts[t + 1] += chunkCounts[t];
+        parallelFor(numThreads, numThreads, [&](int task, int /*thread*/)
+                    {
+            int position = chunkCounts[task];
+            for (int i = chunkBegin(numActiveEdges, task); i < chunkBegin(numActiveEdges, task + 1); i++)
+            {
+                SimpleEdge &edge = allEdges[activeEdges[i]];
+                if (components[edge.sourceNodeId] != components[edge.targetNodeId])
+                    auxActiveEdges[position++] = activeEdges[i];
+            } });
+        numActiveEdges = chunkCounts[numThreads];
+        swap(activeEdges, auxActiveEdges);
+        if (numActiveEdges == 0)
+            break;
 
-        // Adiciona aresta de menor custo à solução
-        SimpleEdge shortestAvailableEdge;
-        shortestAvailableEdge.sourceNodeId = minDistanceSourceId;
-        shortestAvailableEdge.targetNodeId = nearestNodeList[minDistanceSourceId];
-        shortestAvailableEdge.weight = auxNodeList[minDistanceSourceId];
-        solutionEdges.emplace_back(shortestAvailableEdge);
-
-        // Atualiza listas de próximos nós e distâncias
-        nearestNodeList[minDistanceSourceId] = alreadyInSolution;
-        auxNodeList[minDistanceSourceId] = 0;
-        Node *currentNode = this->getNodeById(minDistanceSourceId);
-        for (int m = 0; m < this->order; m++)
-        {
-            if (nearestNodeList[m] > alreadyInSolution)
+        // Aresta mais leve de cada componente, por mínimo atômico
+        parallelFor(numThreads, numThreads, [&](int task, int /*thread*/)
+                    {
+            for (int v = chunkBegin(size, task); v < chunkBegin(size, task + 1); v++)
+                bestKeys[v].store(ULLONG_MAX, memory_order_relaxed); });
+        parallelFor(numThreads, numThreads, [&](int task, int /*thread*/)
+                    {
+            for (int i = chunkBegin(numActiveEdges, task); i < chunkBegin(numActiveEdges, task + 1); i++)
+            {
+                int edgeId = activeEdges[i];
+                unsigned long long key = edgeKey(allEdges[edgeId].weight, edgeId);
+                atomicMin(&bestKeys[components[allEdges[edgeId].sourceNodeId]], key);
+                atomicMin(&bestKeys[components[allEdges[edgeId].targetNodeId]], key);
+            } });
+
+        // Cada raiz aponta para o componente do outro extremo da sua aresta; conta as arestas da solução
+        parallelFor(numThreads, numThreads, [&](int task, int /*thread*/)
+                    {
+            int count = 0;
+            for (int v = chunkBegin(size, task); v < chunkBegin(size, task + 1); v++)
             {
-                float distanceCurrentToM = currentNode->distanceToOtherNode(m);
-                if (auxNodeList[m] > distanceCurrentToM)
+                parents[v] = v;
+                unsigned long long key = bestKeys[v].load(memory_order_relaxed);
+                if (components[v] != v || key == ULLONG_MAX)
+                    continue;
+                SimpleEdge &edge = allEdges[(uint32_t)key];
+                int target = components[edge.sourceNodeId] == v ? components[edge.targetNodeId] : components[edge.sourceNodeId];
+                // Em um par que se escolhe mutuamente, a aresta entra uma só vez e o menor id fica como raiz
+                if (bestKeys[target].load(memory_order_relaxed) == key && v < target)
+                    continue;
+                parents[v] = target;
+                count++;
+            }
+            chunkCounts[task + 1] = count; });
+        chunkCounts[0] = 0;
+        for (int t = 0; t < numThreads; t++)
+            chunkCounts[t + 1] += chunkCounts[t];
+        parallelFor(numThreads, numThreads, [&](int task, int /*thread*/)
+                    {
+            int position = numSolutionEdges + chunkCounts[task];
+            for (int v = chunkBegin(size, task); v < chunkBegin(size, task + 1); v++)
+                if (parents[v] != v)
+                    solutionEdges[position++] = allEdges[(uint32_t)bestKeys[v].load(memory_order_relaxed)];
+        });
+        numSolutionEdges += chunkCounts[numThreads];
+
+        // Saltos de apontadores até que todos apontem para a raiz
+        bool changed = true;
+        while (changed)
+        {
+            atomic<bool> anyChanged(false);
+            parallelFor(numThreads, numThreads, [&](int task, int /*thread*/)
+                        {
+                bool taskChanged = false;
+                for (int v = chunkBegin(size, task); v < chunkBegin(size, task + 1); v++)
                 {
-                    nearestNodeList[m] = minDistanceSourceId;
-                    auxNodeList[m] = distanceCurrentToM;
+                    auxParents[v] = parents[parents[v]];
+                    taskChanged |= auxParents[v] != parents[v];
                 }
-            }
+                if (taskChanged)
+                    anyChanged.store(true, memory_order_relaxed); });
+            swap(parents, auxParents);
+            changed = anyChanged.load();
         }
 
-        // Impressão passo-a-passo
-        //     cout << "J = " << currentNode->getLabel() << endl;
-        //     for (int i = 0; i < this->order; i++)
-        //         cout << "| " << this->getNodeById(i)->getLabel() << " ";
-        //     cout << endl;
-        //     for (int i = 0; i < this->order; i++)
-        //         if (nearestNodeList[i] == -1)
-        //             cout << "| A ";
-        //         else
-        //             cout << "| " << this->getNodeById(nearestNodeList[i])->getLabel() << " ";
-        //     cout << endl;
-        //     for (int i = 0; i < this->order; i++)
-        //     {
-        //         float distance = auxNodeList[i];
-        //         if (distance == FLT_MAX)
-        //             cout << "| $ ";
-        //         else
-        //             cout << "| " << distance << " ";
-        //     }
-        //     cout << endl
-        //          << endl;
+        // Atualiza o componente de cada nó pela raiz do seu antigo componente
+        parallelFor(numThreads, numThreads, [&](int task, int /*thread*/)
+                    {
+            for (int v = chunkBegin(size, task); v < chunkBegin(size, task + 1); v++)
+                components[v] = parents[components[v]]; });
     }
 
-    // Constrói grafo resultado
-    Graph *solutionGraph = new Graph(order, directed, weightedEdge, weightedNode);
-    for (auto &&e : solutionEdges)
+    Graph *solutionGraph = this->createGraphFromEdges(solutionEdges, numSolutionEdges);
+
+    delete[] allEdges;
+    delete[] activeEdges;
+    delete[] auxActiveEdges;
+    delete[] components;
+    delete[] parents;
+    delete[] auxParents;
+    delete[] bestKeys;
+    delete[] chunkCounts;
+    delete[] solutionEdges;
+    return solutionGraph;
+}
+
+/****************
+ * Funcao    : DynamicMST attachDynamicMST()                                                           *
+ * Descricao : Associa ao grafo uma floresta geradora mínima dinâmica, construída com as arestas atuais  *
+ *             e atualizada a cada insertEdge, sem recálculo completo                                   *
+ * Parametros: Sem parâmetros.                                                                          *
+ * Retorno   : Retorna a floresta dinâmica, que pertence ao grafo, ou nullptr se o grafo é direcionado.  *
+ ***************/
+DynamicMST *Graph::attachDynamicMST()
+{
+    if (this->directed)
     {
-        Node *sourceNode = this->getNodeById(e.sourceNodeId);
-        Node *targetNode = this->getNodeById(e.targetNodeId);
-        solutionGraph->insertEdge(sourceNode->getLabel(), targetNode->getLabel(), e.weight);
+        cout << "ERRO: Arvore geradora minima dinamica nao funciona para grafos direcionados!";
+        return nullptr;
     }
-    solutionGraph->fixOrder();
+    if (this->dynamicMST != nullptr)
+        return this->dynamicMST;
 
-    delete nearestNodeList;
-    delete auxNodeList;
-    return solutionGraph;
+    this->dynamicMST = new DynamicMST(max(this->order, this->nodeIdCounter));
+    this->rebuildDynamicMST();
+    return this->dynamicMST;
+}
+
+/****************
+ * Funcao    : void rebuildDynamicMST()                                                *
+ * Descricao : Esvazia a floresta geradora mínima dinâmica e insere as arestas atuais, *
+ *             mantendo o mesmo objeto para quem já o obteve por attachDynamicMST      *
+ * Parametros: Sem parâmetros.                                                         *
+ * Retorno   : Sem retorno.                                                            *
+ ***************/
+void Graph::rebuildDynamicMST()
+{
+    this->dynamicMST->clear();
+    this->dynamicMST->reserve(max(this->order, this->nodeIdCounter));
+    for (Node *n = this->firstNode; n != nullptr; n = n->getNextNode())
+        for (Edge *e = n->getFirstEdge(); e != nullptr; e = e->getNextEdge())
+            if (e->getSourceId() < e->getTargetId())
+            {
+                SimpleEdge edge;
+                edge.sourceNodeId = e->getSourceId();
+                edge.targetNodeId = e->getTargetId();
+                edge.sourceNodeLabel = e->getSourceLabel();
+                edge.targetNodeLabel = e->getTargetLabel();
+                edge.weight = e->getWeight();
+                this->dynamicMST->insertEdge(edge);
+            }
+}
+
+/****************
+ * Funcao    : void notifyDynamicMST(Node *sourceNode, Node *targetNode, float weight)    *
+ * Descricao : Repassa uma aresta recém-inserida à floresta geradora mínima dinâmica      *
+ * Parametros: sourceNode - nó de origem                                                 *
+ *             targetNode - nó de destino                                                *
+ *             weight - peso da aresta                                                   *
+ * Retorno   : Sem retorno.                                                              *
+ ***************/
+void Graph::notifyDynamicMST(Node *sourceNode, Node *targetNode, float weight)
+{
+    SimpleEdge edge;
+    edge.sourceNodeId = sourceNode->getId();
+    edge.targetNodeId = targetNode->getId();
+    edge.sourceNodeLabel = sourceNode->getLabel();
+    edge.targetNodeLabel = targetNode->getLabel();
+    edge.weight = weight;
+    this->dynamicMST->insertEdge(edge);
 }
 
 // Conjunto dominante
@@ -933,6 +1291,22 @@ Node **Graph::copyNodePointersToArray(int *size, bool **coveredList)
     return nodeList;
 }
 
+/****************
+ * Funcao    : Node copyNodePointersToArray(int *size)                                         *
+ * Descricao : Captar todos os nós do grafo e copiar os seus respectivos ponteiros em um array *
+ * Parametros: size - endereço que guardará o tamanho do meu array gerado                      *
+ * Retorno   : Retorna um array com os ponteiros para os nós do grafo                          *
+ ***************/
+Node **Graph::copyNodePointersToArray(int *size)
+{
+    Node **nodeList = new Node *[this->order];
+    int i = 0;
+    for (Node *n = this->firstNode; n != nullptr; n = n->getNextNode())
+        nodeList[i++] = n;
+    *size = i;
+    return nodeList;
+}
+
 /****************
  * Funcao    : void sortNodesByDegreeAndWeight(Node **nodeList, int size)   *
  * Descricao : Ordena uma lista de nós pela heurística: GRAU/PESO           *
@@ -962,7 +1336,9 @@ void Graph::sortNodesByDegreeAndWeight(Node **nodeList, int size)
 
 /****************
  * Funcao    : void dominatingSetWeighted(float *totalCost)                                 *
- * Descricao : Encontra um subconjunto dominante ponderado com um algoritmo guloso          *
+ * Descricao : Encontra um subconjunto dominante ponderado com um algoritmo guloso, com os  *
+ *             candidatos em um heap de máximo pela heurística GRAU/PESO e a cobertura no   *
+ *             kernel de bits                                                               *
  * Parametros: totalCost - custo total da solução                                           *
  * Retorno   : Retorna uma lista de nós solução.                                            *
  ***************/
@@ -970,298 +1346,670 @@ list<SimpleNode> Graph::dominatingSetWeighted(float *totalCost)
 {
     list<SimpleNode> solutionSet;
     int candidates;
-    bool *nodeCovered;
-    Node **nodeList = this->copyNodePointersToArray(&candidates, &nodeCovered);
+    Node **nodeList = this->copyNodePointersToArray(&candidates);
+    CoverageKernel *coverageKernel = new CoverageKernel(this);
+    uint64_t *uncovered = coverageKernel->createUncoveredSet();
+    int *coveredIds = new int[candidates > 0 ? candidates : 1];
+
+    // Empates favorecem o maior id, como o último da ordenação estável por GRAU/PESO
+    IndexedHeap *candidateHeap = new IndexedHeap(this->order, true);
+    for (int i = 0; i < candidates; i++)
+        candidateHeap->push(nodeList[i]->getId(), nodeList[i]->getInDegree() / nodeList[i]->getWeight());
 
     // Processo iterativo
-    while (candidates > 0)
+    while (!candidateHeap->isEmpty())
     {
         // Encontra melhor nó
-        this->sortNodesByDegreeAndWeight(nodeList, candidates);
-        int bestIndex = candidates - 1;
-        int bestId = nodeList[bestIndex]->getId();
-        // printList(nodeList, candidates);
-        // cout << "Escolhido: " << nodeList[bestIndex]->getLabel()
-        //      << endl;
+        int bestId = candidateHeap->pop();
+        Node *bestNode = nodeList[bestId];
 
         // Adiciona nó à solução
         SimpleNode simpleNode;
         simpleNode.id = bestId;
-        simpleNode.label = nodeList[bestIndex]->getLabel();
-        simpleNode.degree = nodeList[bestIndex]->getInDegree();
-        simpleNode.weight = nodeList[bestIndex]->getWeight();
+        simpleNode.label = bestNode->getLabel();
+        simpleNode.degree = bestNode->getInDegree();
+        simpleNode.weight = bestNode->getWeight();
         solutionSet.emplace_back(simpleNode);
         (*totalCost) += simpleNode.weight;
-        nodeCovered[bestId] = true;
 
-        // Marca nós ligados como cobertos
-        for (Edge *e = nodeList[bestIndex]->getFirstEdge(); e != nullptr; e = e->getNextEdge())
-        {
-            int targetId = e->getTargetId();
-            nodeCovered[targetId] = true;
-        }
+        // Cobre a vizinhança fechada e remove dos candidatos os nós cobertos agora
+        int numCovered = coverageKernel->cover(uncovered, bestId, coveredIds);
+        for (int i = 0; i < numCovered; i++)
+            if (candidateHeap->contains(coveredIds[i]))
+                candidateHeap->remove(coveredIds[i]);
+    }
+
+    // Limpa a memória
+    delete candidateHeap;
+    freeBitset(uncovered);
+    delete coverageKernel;
+    delete[] coveredIds;
+    delete[] nodeList;
+
+    return solutionSet;
+}
+
+/****************
+ * Funcao    : void dominatingSetWeightedDynamic(float *totalCost)                                        *
+ * Descricao : Encontra um subconjunto dominante ponderado com um algoritmo guloso de ganho dinâmico: a   *
+ *             chave de cada nó é a quantidade de nós ainda descobertos na sua vizinhança fechada sobre o  *
+ *             seu peso. Os nós cobertos por cada escolha saem do kernel de bits, e só as chaves dos nós   *
+ *             que os cobrem (vizinhança de 2 saltos do nó escolhido) são atualizadas.                     *
+ * Parametros: totalCost - custo total da solução                                                         *
+ * Retorno   : Retorna uma lista de nós solução.                                                          *
+ ***************/
+list<SimpleNode> Graph::dominatingSetWeightedDynamic(float *totalCost)
+{
+    list<SimpleNode> solutionSet;
+    int size;
+    Node **nodeList = this->copyNodePointersToArray(&size);
+    CoverageKernel *coverageKernel = new CoverageKernel(this);
+    uint64_t *uncovered = coverageKernel->createUncoveredSet();
+    int *coveredIds = new int[size > 0 ? size : 1];
+
+    // Arestas de saída (quem o nó cobre) e de entrada (quem cobre o nó)
+    CompactGraph *forwardGraph = new CompactGraph(this, false);
+    CompactGraph *reverseGraph = this->directed ? new CompactGraph(this, true) : forwardGraph;
+    int *offsets = forwardGraph->getOffsets();
+    int *reverseOffsets = reverseGraph->getOffsets();
+    int *reverseTargets = reverseGraph->getTargets();
+
+    // Ganho inicial: o próprio nó mais seus vizinhos
+    int *gains = new int[size];
+    IndexedHeap *candidateHeap = new IndexedHeap(size, true);
+    for (int i = 0; i < size; i++)
+    {
+        gains[i] = 1 + offsets[i + 1] - offsets[i];
+        candidateHeap->push(i, gains[i] / nodeList[i]->getWeight());
+    }
+
+    // Processo iterativo
+    while (!candidateHeap->isEmpty())
+    {
+        // Encontra melhor nó
+        int bestId = candidateHeap->pop();
+        Node *bestNode = nodeList[bestId];
+
+        // Adiciona nó à solução
+        SimpleNode simpleNode;
+        simpleNode.id = bestId;
+        simpleNode.label = bestNode->getLabel();
+        simpleNode.degree = bestNode->getInDegree();
+        simpleNode.weight = bestNode->getWeight();
+        solutionSet.emplace_back(simpleNode);
+        (*totalCost) += simpleNode.weight;
 
-        // Remove nós cobertos
-        int k = 0;
-        for (int n = 0; n < candidates; n++)
+        // Cobre a vizinhança fechada e desconta o ganho de quem cobria cada nó novo
+        int numCovered = coverageKernel->cover(uncovered, bestId, coveredIds);
+        for (int i = 0; i < numCovered; i++)
         {
-            if (nodeCovered[nodeList[n + k]->getId()])
+            int coveredId = coveredIds[i];
+            for (int r = reverseOffsets[coveredId] - 1; r < reverseOffsets[coveredId + 1]; r++)
             {
-                candidates--;
-                k++;
-                n--;
+                int coveringId = r < reverseOffsets[coveredId] ? coveredId : reverseTargets[r];
+                gains[coveringId]--;
+                if (!candidateHeap->contains(coveringId))
+                    continue;
+                if (gains[coveringId] == 0)
+                    candidateHeap->remove(coveringId);
+                else
+                    candidateHeap->updateKey(coveringId, gains[coveringId] / nodeList[coveringId]->getWeight());
             }
-            else
-                nodeList[n] = nodeList[n + k];
         }
-        // printList(nodeList, candidates);
-        // cout << "=-=-=" << endl;
-
-        // Verifica cobertura total
-        if (isSolved(nodeList, nodeCovered, candidates))
-            break;
     }
 
     // Limpa a memória
+    delete candidateHeap;
+    if (reverseGraph != forwardGraph)
+        delete reverseGraph;
+    delete forwardGraph;
+    delete[] gains;
+    freeBitset(uncovered);
+    delete coverageKernel;
+    delete[] coveredIds;
     delete[] nodeList;
-    delete[] nodeCovered;
-
-    // cout << "\nCusto: " << *totalCost << "\n==========" << endl
-    //      << endl;
 
     return solutionSet;
 }
 
 /****************
- * Funcao    : void dominatingSetWeightedRandomized(float *totalCost, int numIterations, float alfa)    *
- * Descricao : Encontra um subconjunto dominante ponderado com um algoritmo guloso randomizado          *
- * Parametros: totalCost -  custo total da solução                                                      *
-               seed - semente de randomização                                                           *
-               numIterations - número máximo de iterações do algoritmo                                  *
-               alfa - valor de alfa                                                                     *
- * Retorno   : Retorna uma lista de nós solução.                                                        *
+ * Funcao    : float dominatingSetLowerBound()                                                       *
+ * Descricao : Calcula um limite inferior do custo do conjunto dominante ponderado pela relaxação       *
+ *             lagrangiana, em tempo linear por varredura; a diferença para o custo de uma solução       *
+ *             limita a distância dela ao ótimo                                                        *
+ * Parametros: sem parâmetros.                                                                         *
+ * Retorno   : Retorna o limite inferior.                                                              *
  ***************/
-list<SimpleNode> Graph::dominatingSetWeightedRandomized(float *totalCost, CARDINAL seed, int numIterations, float alfa)
+float Graph::dominatingSetLowerBound()
 {
-    list<SimpleNode> bestSolutionSet;
-    *totalCost = FLT_MAX;
-    xrandomize(seed);
+    int size;
+    Node **nodeList = this->copyNodePointersToArray(&size);
+    float *weights = new float[size];
+    for (int i = 0; i < size; i++)
+        weights[i] = nodeList[i]->getWeight();
+    CompactGraph *forwardGraph = new CompactGraph(this, false);
+    CompactGraph *reverseGraph = this->directed ? new CompactGraph(this, true) : forwardGraph;
+
+    DominatingSetLowerBound *lowerBound = new DominatingSetLowerBound(forwardGraph, reverseGraph, weights);
+    float bound = lowerBound->compute(LOWER_BOUND_SWEEPS);
+
+    // Limpa a memória
+    delete lowerBound;
+    if (reverseGraph != forwardGraph)
+        delete reverseGraph;
+    delete forwardGraph;
+    delete[] weights;
+    delete[] nodeList;
+
+    return bound;
+}
 
-    for (int z = 0; z < numIterations; z++)
+/****************
+ * Funcao    : unsigned long long solutionKey(float cost, int iteration)                                *
+ * Descricao : Codifica custo e iteração em uma chave inteira cuja ordem é a do custo, desempatada pela  *
+ *             menor iteração, para a comparação atômica entre threads                                  *
+ * Parametros: cost - custo da solução                                                                  *
+ *             iteration - índice da iteração que construiu a solução                                   *
+ * Retorno   : Chave da solução.                                                                        *
+ ***************/
+static unsigned long long solutionKey(float cost, int iteration)
+{
+    unsigned int bits;
+    memcpy(&bits, &cost, sizeof(bits));
+    bits = (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+    return ((unsigned long long)bits << 32) | (unsigned int)iteration;
+}
+
+/****************
+ * Funcao    : void updateBestKey(atomic<unsigned long long> *bestKey, unsigned long long key)   *
+ * Descricao : Atualiza, sem trava, o mínimo global das chaves de solução                        *
+ * Parametros: bestKey - mínimo global compartilhado entre as threads                           *
+ *             key - chave da solução recém-construída                                          *
+ * Retorno   : Sem retorno.                                                                     *
+ ***************/
+static void updateBestKey(atomic<unsigned long long> *bestKey, unsigned long long key)
+{
+    unsigned long long currentBest = bestKey->load(memory_order_relaxed);
+    while (key < currentBest && !bestKey->compare_exchange_weak(currentBest, key, memory_order_relaxed))
+        ;
+}
+
+/****************
+ * Funcao    : bool stopRequested(StoppingCriteria *stoppingCriteria, double startTime, unsigned long long bestKey, int iteration, float lowerBound)*
+ * Descricao : Verifica, antes de uma iteração, se algum critério de parada foi atingido: melhor solução igual ao      *
+ *             limite inferior (ótimo comprovado), cancelamento externo, tempo de relógio esgotado, custo alvo        *
+ *             alcançado pela melhor solução ou iterações demais desde a iteração que a encontrou                     *
+ * Parametros: stoppingCriteria - critérios de parada; nullptr limita pelo número de iterações e pelo limite inferior*
+ *             startTime - instante de início da execução (wallClock)                                                *
+ *             bestKey - chave da melhor solução encontrada até o momento                                            *
+ *             iteration - índice da iteração a executar                                                             *
+ *             lowerBound - limite inferior do custo das soluções                                                    *
+ * Retorno   : Retorna true se a execução deve parar.                                                                *
+ ***************/
+static bool stopRequested(StoppingCriteria *stoppingCriteria, double startTime, unsigned long long bestKey, int iteration, float lowerBound)
+{
+    // A tolerância absorve o arredondamento da soma dos pesos da solução
+    if (bestKey != ULLONG_MAX && bestKey <= solutionKey(lowerBound + 1e-3f, -1))
+        return true;
+    if (stoppingCriteria == nullptr)
+        return false;
+    if (stoppingCriteria->cancelled != nullptr && stoppingCriteria->cancelled->load(memory_order_relaxed))
+        return true;
+    if (stoppingCriteria->timeLimit > 0 && wallClock() - startTime >= stoppingCriteria->timeLimit)
+        return true;
+    if (bestKey == ULLONG_MAX)
+        return false;
+    // A chave do alvo com a maior iteração possível delimita as soluções de custo <= alvo
+    if (stoppingCriteria->targetCost >= 0 && bestKey <= solutionKey(stoppingCriteria->targetCost, -1))
+        return true;
+    int bestIteration = (int)(unsigned int)bestKey;
+    return stoppingCriteria->maxStagnation > 0 && iteration - bestIteration > stoppingCriteria->maxStagnation;
+}
+
+/****************
+ * Funcao    : int selectRestrictedCandidate(int *candidates, int numCandidates, int rclSize, int rank, const float *scores)*
+ * Descricao : Monta a lista restrita de candidatos por seleção, sem ordenar: os rclSize melhores nós pela pontuação    *
+ *             (empates pelo maior id, como na ordenação estável anterior) são separados no início do vetor em O(n), e  *
+ *             dentre eles é escolhido o de posição rank na ordem da pontuação                                         *
+ * Parametros: candidates - ids dos nós candidatos, reordenados pela seleção                                          *
+ *             numCandidates - quantidade de candidatos                                                               *
+ *             rclSize - tamanho da lista restrita de candidatos                                                      *
+ *             rank - posição sorteada na lista restrita (0 é o melhor candidato)                                     *
+ *             scores - pontuação de cada candidato, indexada pelo id                                                 *
+ * Retorno   : Retorna o id do candidato escolhido.                                                                   *
+ ***************/
+int Graph::selectRestrictedCandidate(int *candidates, int numCandidates, int rclSize, int rank, const float *scores)
+{
+    auto better = [scores](int first, int second)
+    { return scores[first] != scores[second] ? scores[first] > scores[second] : first > second; };
+    if (rclSize < numCandidates)
+        nth_element(candidates, candidates + rclSize - 1, candidates + numCandidates, better);
+    nth_element(candidates, candidates + rank, candidates + rclSize, better);
+    return candidates[rank];
+}
+
+/****************
+ * Funcao    : float randomizedConstruction(float alfa, CoverageKernel *coverageKernel, const float *heuristics, const float *weights, SolverWorkspace *workspace, RANDOM_STREAM *stream)*
+ * Descricao : Constrói uma solução do guloso randomizado na solução corrente da área de trabalho, sorteando cada nó *
+ *             entre os ceil(candidatos * alfa) melhores pela heurística GRAU/PESO; os candidatos são os nós ainda  *
+ *             descobertos. Os nós cobertos por cada escolha vêm do kernel e recebem a pior pontuação, ficando fora *
+ *             da lista restrita; eles só saem do vetor quando passam da metade dele.                              *
+ * Parametros: alfa - valor de alfa                                                                                  *
+ *             coverageKernel - vizinhanças em bits do grafo                                                         *
+ *             heuristics - heurística GRAU/PESO de cada nó, indexada pelo id                                        *
+ *             weights - peso de cada nó, indexado pelo id                                                           *
+ *             workspace - área de trabalho da thread                                                                *
+ *             stream - fluxo de números aleatórios da construção                                                    *
+ * Retorno   : Retorna o custo total da solução.                                                                     *
+ ***************/
+float Graph::randomizedConstruction(float alfa, CoverageKernel *coverageKernel, const float *heuristics, const float *weights, SolverWorkspace *workspace, RANDOM_STREAM *stream)
+{
+    float totalCost = 0;
+    int candidates = workspace->getSize();
+    int *candidateList = workspace->getCandidates();
+    float *scores = workspace->getScores();
+    int *coveredIds = workspace->getCoveredIds();
+    uint64_t *uncovered = workspace->getUncovered();
+    for (int i = 0; i < candidates; i++)
     {
-        // cout << "ITERACAO " << (z + 1) << endl
-        //      << endl;
-        float currentTotalCost = 0;
-        list<SimpleNode> solutionSet;
-        int candidates;
-        bool *nodeCovered;
-        Node **nodeList = this->copyNodePointersToArray(&candidates, &nodeCovered);
-        while (candidates > 0)
+        candidateList[i] = i;
+        scores[i] = heuristics[i];
+    }
+    int numUncovered = candidates;
+    coverageKernel->resetUncoveredSet(uncovered);
+    workspace->clearSolution();
+    while (numUncovered > 0)
+    {
+        // Descarta os nós cobertos quando são a maioria do vetor
+        if (2 * numUncovered < candidates)
         {
-            // Seleciona um dentre os melhores nós
-            this->sortNodesByDegreeAndWeight(nodeList, candidates);
-            int randomPosition = xrandom(ceil(candidates * alfa)); // 0 a teto da seleção (excluído)
-            int randomIndex = candidates - 1 - randomPosition;
-            int bestId = nodeList[randomIndex]->getId();
-            // printList(nodeList, candidates);
-            // cout << "Escolhido: " << nodeList[randomIndex]->getLabel()
-            //      << endl;
-
-            // Adiciona à solução
-            SimpleNode simpleNode;
-            simpleNode.id = bestId;
-            simpleNode.label = nodeList[randomIndex]->getLabel();
-            simpleNode.degree = nodeList[randomIndex]->getInDegree();
-            simpleNode.weight = nodeList[randomIndex]->getWeight();
-            solutionSet.emplace_back(simpleNode);
-            currentTotalCost += simpleNode.weight;
-            nodeCovered[bestId] = true;
-
-            // Marca nós ligados como cobertos
-            for (Edge *e = nodeList[randomIndex]->getFirstEdge(); e != nullptr; e = e->getNextEdge())
-            {
-                int targetId = e->getTargetId();
-                nodeCovered[targetId] = true;
-            }
-
-            // Remove nós cobertos
             int k = 0;
             for (int n = 0; n < candidates; n++)
-            {
-                if (nodeCovered[nodeList[n + k]->getId()])
-                {
-                    candidates--;
-                    k++;
-                    n--;
-                }
-                else
-                    nodeList[n] = nodeList[n + k];
-            }
-            // printList(nodeList, candidates);
-            // cout << "=-=-=" << endl;
+                if (!coverageKernel->isCovered(uncovered, candidateList[n]))
+                    candidateList[k++] = candidateList[n];
+            candidates = k;
+        }
 
-            // Verifica cobertura total
-            if (isSolved(nodeList, nodeCovered, candidates))
-                break;
+        // Seleciona um dentre os melhores nós descobertos
+        int rclSize = max((int)ceil(numUncovered * alfa), 1);
+        int randomPosition = xrandom_stream(stream, rclSize); // 0 a teto da seleção (excluído)
+        int bestId = this->selectRestrictedCandidate(candidateList, candidates, rclSize, randomPosition, scores);
+
+        // Adiciona à solução
+        workspace->addNode(bestId);
+        totalCost += weights[bestId];
+
+        // Marca o nó e os nós ligados como cobertos, que passam a perder para qualquer nó descoberto
+        int numCovered = coverageKernel->cover(uncovered, bestId, coveredIds);
+        numUncovered -= numCovered;
+        for (int i = 0; i < numCovered; i++)
+            scores[coveredIds[i]] = -FLT_MAX;
+    }
+
+    return totalCost;
+}
+
+/****************
+ * Funcao    : list<SimpleNode> createSolutionList(int *solution, int solutionSize, Node **nodeList)  *
+ * Descricao : Converte uma solução em vetor de ids para a lista de nós devolvida pelos algoritmos   *
+ * Parametros: solution - ids dos nós da solução                                                     *
+ *             solutionSize - quantidade de nós da solução                                           *
+ *             nodeList - nós do grafo indexados pelo id                                             *
+ * Retorno   : Retorna uma lista de nós solução.                                                     *
+ ***************/
+list<SimpleNode> Graph::createSolutionList(int *solution, int solutionSize, Node **nodeList)
+{
+    list<SimpleNode> solutionSet;
+    for (int i = 0; i < solutionSize; i++)
+    {
+        SimpleNode simpleNode;
+        simpleNode.id = solution[i];
+        simpleNode.label = nodeList[solution[i]]->getLabel();
+        simpleNode.degree = nodeList[solution[i]]->getInDegree();
+        simpleNode.weight = nodeList[solution[i]]->getWeight();
+        solutionSet.emplace_back(simpleNode);
+    }
+    return solutionSet;
+}
+
+/****************
+ * Funcao    : void dominatingSetWeightedRandomized(float *totalCost, CARDINAL seed, int numIterations, float alfa, int numThreads)*
+ * Descricao : Encontra um subconjunto dominante ponderado com um algoritmo guloso randomizado. As iterações são       *
+ *             independentes e distribuídas entre as threads; cada iteração usa seu próprio fluxo de números          *
+ *             aleatórios, derivado da semente e do seu índice, e cada thread sua própria área de trabalho, de modo   *
+ *             que a mesma semente dá o mesmo resultado com qualquer quantidade de threads. Cada solução construída   *
+ *             é levada a um ótimo local (remoção de nós redundantes e trocas 1-1 e 2-1) antes de ser comparada.      *
+ *             A busca para quando a melhor solução alcança o limite inferior lagrangiano.                            *
+ *             Construções repetidas, reconhecidas pela assinatura Zobrist, são descartadas sem busca local. As       *
+ *             iterações correm em blocos de tamanho fixo: durante o bloco, só as assinaturas dos blocos anteriores   *
+ *             são consultadas, e a repetição dentro do bloco é atribuída, ao fim dele, à iteração de maior índice.   *
+ * Parametros: totalCost -  custo total da solução                                                                    *
+               seed - semente de randomização                                                                         *
+               numIterations - número máximo de iterações do algoritmo                                                *
+               alfa - valor de alfa                                                                                   *
+               numThreads - quantidade de threads; valores <= 0 usam todos os núcleos                                 *
+               stoppingCriteria - critérios de parada antecipada; nullptr executa todas as iterações                  *
+               statistics - endereço das estatísticas da execução; nullptr não as informa                            *
+ * Retorno   : Retorna uma lista de nós solução.                                                                      *
+ ***************/
+list<SimpleNode> Graph::dominatingSetWeightedRandomized(float *totalCost, CARDINAL seed, int numIterations, float alfa, int numThreads, StoppingCriteria *stoppingCriteria, SearchStatistics *statistics)
+{
+    numThreads = resolveThreads(numThreads);
+    double startTime = wallClock();
+
+    // Vizinhanças em bits, heurísticas e adjacências da busca local, compartilhadas por todas as iterações
+    CoverageKernel *coverageKernel = new CoverageKernel(this);
+    int size;
+    Node **nodeList = this->copyNodePointersToArray(&size);
+    float *weights = new float[size];
+    float *heuristics = new float[size];
+    for (int i = 0; i < size; i++)
+    {
+        weights[i] = nodeList[i]->getWeight();
+        // Os nós de peso zero (pendentes da redução) vêm primeiro, sem dividir por zero
+        heuristics[i] = weights[i] > 0 ? nodeList[i]->getInDegree() / weights[i] : FLT_MAX;
+    }
+    CompactGraph *forwardGraph = new CompactGraph(this, false);
+    CompactGraph *reverseGraph = this->directed ? new CompactGraph(this, true) : forwardGraph;
+
+    // Uma solução com o custo do limite inferior é ótima e encerra a busca
+    DominatingSetLowerBound *dominatingSetLowerBound = new DominatingSetLowerBound(forwardGraph, reverseGraph, weights);
+    float lowerBound = dominatingSetLowerBound->compute(LOWER_BOUND_SWEEPS);
+    delete dominatingSetLowerBound;
+
+    // Área de trabalho de cada thread, com a sua melhor solução, e as threads que a usam
+    SolverWorkspace **workspaces = new SolverWorkspace *[numThreads];
+    for (int t = 0; t < numThreads; t++)
+        workspaces[t] = new SolverWorkspace(coverageKernel, forwardGraph, reverseGraph, weights);
+    reserveThreads(numThreads);
+    atomic<unsigned long long> bestKey(ULLONG_MAX);
+    atomic<bool> stopped(false);
+    SolutionHashSet *constructions = new SolutionHashSet(numIterations);
+    atomic<int> numberIterations(0), numberDuplicates(0);
+
+    // Assinatura e busca local de cada iteração do bloco
+    unsigned long long *blockHashes = new unsigned long long[RANDOMIZED_BLOCK];
+    bool *blockBuilt = new bool[RANDOMIZED_BLOCK];
+
+    // Construção de uma iteração do bloco, criada uma única vez para todos os blocos
+    int blockStart = 0;
+    function<void(int, int)> buildSolution = [&](int i, int thread)
+    {
+        int z = blockStart + i;
+
+        // As iterações restantes após um critério de parada são descartadas
+        blockBuilt[i] = false;
+        if (stopped.load(memory_order_relaxed) || stopRequested(stoppingCriteria, startTime, bestKey.load(), z, lowerBound))
+        {
+            stopped.store(true, memory_order_relaxed);
+            return;
         }
 
-        // Verifica se a nova solução gerada é melhor que a anterior
-        if (currentTotalCost < *totalCost)
+        RANDOM_STREAM stream;
+        xrandomize_stream(&stream, seed, z);
+        SolverWorkspace *workspace = workspaces[thread];
+        this->randomizedConstruction(alfa, coverageKernel, heuristics, weights, workspace, &stream);
+        numberIterations++;
+        // Durante o bloco, só as construções dos blocos anteriores são consultadas
+        blockHashes[i] = workspace->getSolutionHash();
+        if (constructions->contains(blockHashes[i]))
         {
-            // Atualiza a lista da melhor solução;
-            *totalCost = currentTotalCost;
-            bestSolutionSet.clear();
-            for (auto &&node : solutionSet)
-                bestSolutionSet.emplace_back(node);
+            numberDuplicates++;
+            return;
         }
+        blockBuilt[i] = true;
+        float currentTotalCost = workspace->improveSolution();
+
+        // Guarda a nova solução se for melhor que a anterior da thread
+        unsigned long long key = solutionKey(currentTotalCost, z);
+        workspace->keepIfBest(key);
+        updateBestKey(&bestKey, key);
+    };
+
+    for (blockStart = 0; blockStart < numIterations && !stopped.load(); blockStart += RANDOMIZED_BLOCK)
+    {
+        int blockSize = min(RANDOMIZED_BLOCK, numIterations - blockStart);
+        parallelFor(blockSize, numThreads, buildSolution);
+
+        // Guarda as assinaturas na ordem das iterações: a repetição é atribuída à de maior índice
+        for (int i = 0; i < blockSize; i++)
+            if (blockBuilt[i] && !constructions->insert(blockHashes[i]))
+                numberDuplicates++;
+    }
 
-        // Limpa a memória
-        delete[] nodeList;
-        delete[] nodeCovered;
+    // Recupera a solução da thread que detém o mínimo global
+    list<SimpleNode> bestSolutionSet;
+    *totalCost = FLT_MAX;
+    for (int t = 0; t < numThreads; t++)
+        if (workspaces[t]->getBestKey() == bestKey.load() && workspaces[t]->getBestKey() != ULLONG_MAX)
+        {
+            bestSolutionSet = this->createSolutionList(workspaces[t]->getBestSolution(), workspaces[t]->getBestSolutionSize(), nodeList);
+            *totalCost = 0;
+            for (auto &&node : bestSolutionSet)
+                *totalCost += node.weight;
+        }
 
-        // cout << "\nCusto: " << *totalCost << "\n==========" << endl
-        //      << endl;
+    if (statistics != nullptr)
+    {
+        statistics->numberIterations = numberIterations.load();
+        statistics->numberDuplicates = numberDuplicates.load();
+        statistics->numberRelinked = 0;
+        statistics->lowerBound = lowerBound;
     }
 
+    // Limpa a memória
+    for (int t = 0; t < numThreads; t++)
+        delete workspaces[t];
+    delete[] workspaces;
+    delete[] blockHashes;
+    delete[] blockBuilt;
+    delete constructions;
+    delete coverageKernel;
+    if (reverseGraph != forwardGraph)
+        delete reverseGraph;
+    delete forwardGraph;
+    delete[] weights;
+    delete[] heuristics;
+    delete[] nodeList;
+
     return bestSolutionSet;
 }
 
 /****************
- * Funcao    : void dominatingSetWeightedRandomizedReactive(float *totalCost, int numIterations, float *vetAlfas, int m, int block)*
- * Descricao : Encontra um subconjunto dominante ponderado com um algoritmo guloso randomizado reativo   *
- * Parametros: totalCost -  custo total da solução                                                      *
-               seed - semente de randomização                                                           *
-               numIterations - número máximo de iterações do algoritmo                                  *
-               vetAlfas - vetor de valores que alfa pode assumir                                        *
-               tam - quantidade de alfas                                                                *
-               block - tamanho do bloco de iterações                                                    *
-               bestAlfa - melhor alfa encontrado para a resolução do problema                           *
- * Retorno   : Retorna uma lista de nós solução.                                                        *
+ * Funcao    : void dominatingSetWeightedRandomizedReactive(float *totalCost, CARDINAL seed, int numIterations, float *vetAlfas, int tam, int block, float *bestAlfa, int eliteSize, int numThreads)*
+ * Descricao : Encontra um subconjunto dominante ponderado com um algoritmo guloso randomizado reativo. As iterações   *
+ *             de cada bloco são executadas em paralelo: a divisão do bloco entre os alfas é calculada no início,     *
+ *             como na versão sequencial, e os custos do bloco são agregados nas médias, na ordem das iterações, ao   *
+ *             fim dele, antes de recalcular as probabilidades. Cada iteração usa seu próprio fluxo de números        *
+ *             aleatórios, de modo que o resultado não depende da quantidade de threads. As médias usam o custo de    *
+ *             cada solução depois da busca local.                                                                    *
+ *             A busca para quando a melhor solução alcança o limite inferior lagrangiano.                            *
+ *             Construções repetidas, reconhecidas pela assinatura Zobrist, são descartadas sem busca local; a        *
+ *             repetição dentro do bloco é resolvida ao fim dele, pela ordem das iterações.                           *
+ *             As melhores soluções distintas formam um conjunto elite, atualizado ao fim de cada bloco na ordem das  *
+ *             iterações; cada ótimo local é religado a uma solução elite sorteada, e a melhor solução intermediária  *
+ *             do caminho, após a busca local, substitui o ótimo local se for mais barata.                            *
+ * Parametros: totalCost -  custo total da solução                                                                    *
+               seed - semente de randomização                                                                         *
+               numIterations - número máximo de iterações do algoritmo                                                *
+               vetAlfas - vetor de valores que alfa pode assumir                                                      *
+               tam - quantidade de alfas                                                                              *
+               block - tamanho do bloco de iterações                                                                  *
+               bestAlfa - melhor alfa encontrado para a resolução do problema                                         *
+               eliteSize - quantidade de soluções do conjunto elite; 0 desliga o religamento de caminhos              *
+               numThreads - quantidade de threads; valores <= 0 usam todos os núcleos                                 *
+               stoppingCriteria - critérios de parada antecipada; nullptr executa todas as iterações                  *
+               statistics - endereço das estatísticas da execução; nullptr não as informa                            *
+ * Retorno   : Retorna uma lista de nós solução.                                                                      *
  ***************/
-list<SimpleNode> Graph ::dominatingSetWeightedRandomizedReactive(float *totalCost, CARDINAL seed, int numIterations, float *vetAlfas, int tam, int block, float *bestAlfa)
+list<SimpleNode> Graph ::dominatingSetWeightedRandomizedReactive(float *totalCost, CARDINAL seed, int numIterations, float *vetAlfas, int tam, int block, float *bestAlfa, int eliteSize, int numThreads, StoppingCriteria *stoppingCriteria, SearchStatistics *statistics)
 {
-    list<SimpleNode> bestSolutionSet;
+    numThreads = resolveThreads(numThreads);
+    double startTime = wallClock();
+    if (block < 1)
+        block = 1;
     *totalCost = FLT_MAX;
-    xrandomize(seed);
 
     // Número de iterações para cada alfa
     int *iterEachAlfa;
     // Probabilidade de cada alfa
     float *probabilities;
     int *numIterPerAlfa;
-    int counterChooseAlfa;
-    int auxChooseAlfa;
-    float alfa = 0;
     // Média da qualidade das soluções obtidas quando se utilizou cada alfa na construção;
     float *averages;
 
     initializeProbabilities(&iterEachAlfa, &probabilities, &numIterPerAlfa, &averages, tam);
 
-    // Constrói uma solução
-    for (int z = 0; z < numIterations; z++)
+    // Alfa, custo e execução de cada iteração do bloco
+    int *blockAlfas = new int[block];
+    float *blockCosts = new float[block];
+    bool *blockBuilt = new bool[block];
+    unsigned long long *blockHashes = new unsigned long long[block];
+
+    // Vizinhanças em bits, heurísticas e adjacências da busca local, compartilhadas por todas as iterações
+    CoverageKernel *coverageKernel = new CoverageKernel(this);
+    int size;
+    Node **nodeList = this->copyNodePointersToArray(&size);
+    float *weights = new float[size];
+    float *heuristics = new float[size];
+    for (int i = 0; i < size; i++)
+    {
+        weights[i] = nodeList[i]->getWeight();
+        // Os nós de peso zero (pendentes da redução) vêm primeiro, sem dividir por zero
+        heuristics[i] = weights[i] > 0 ? nodeList[i]->getInDegree() / weights[i] : FLT_MAX;
+    }
+    CompactGraph *forwardGraph = new CompactGraph(this, false);
+    CompactGraph *reverseGraph = this->directed ? new CompactGraph(this, true) : forwardGraph;
+
+    // Uma solução com o custo do limite inferior é ótima e encerra a busca
+    DominatingSetLowerBound *dominatingSetLowerBound = new DominatingSetLowerBound(forwardGraph, reverseGraph, weights);
+    float lowerBound = dominatingSetLowerBound->compute(LOWER_BOUND_SWEEPS);
+    delete dominatingSetLowerBound;
+
+    // Área de trabalho de cada thread, com a sua melhor solução, e as threads que a usam
+    SolverWorkspace **workspaces = new SolverWorkspace *[numThreads];
+    for (int t = 0; t < numThreads; t++)
+        workspaces[t] = new SolverWorkspace(coverageKernel, forwardGraph, reverseGraph, weights);
+    reserveThreads(numThreads);
+    atomic<unsigned long long> bestKey(ULLONG_MAX);
+    atomic<bool> stopped(false);
+    SolutionHashSet *constructions = new SolutionHashSet(numIterations);
+    atomic<int> numberIterations(0), numberDuplicates(0), numberRelinked(0);
+
+    // Conjunto elite e solução final de cada iteração do bloco, oferecida ao conjunto ao fim dele
+    ElitePool *elitePool = new ElitePool(eliteSize, size);
+    float *blockFinalCosts = new float[block];
+    int *blockSolutionSizes = new int[block];
+    int **blockSolutions = new int *[block];
+    for (int i = 0; i < block; i++)
+        blockSolutions[i] = elitePool->getCapacity() > 0 ? new int[size] : nullptr;
+
+    // Construção de uma iteração do bloco, criada uma única vez para todos os blocos
+    int blockStart = 0;
+    function<void(int, int)> buildSolution = [&](int i, int thread)
     {
-        // cout << "ITERACAO " << (z + 1) << endl
-        //      << endl;
-        if (z % block == 0)
+        int z = blockStart + i;
+
+        // As iterações restantes após um critério de parada são descartadas
+        blockBuilt[i] = false;
+        if (stopped.load(memory_order_relaxed) || stopRequested(stoppingCriteria, startTime, bestKey.load(), z, lowerBound))
         {
-            counterChooseAlfa = 0;
-            auxChooseAlfa = 0;
-            updateProbabilities(probabilities, averages, *totalCost, tam);
-            int numIterPerAlfaPrevious = 0;
-            for (int y = 0; y < tam - 1; y++)
-            {
-                numIterPerAlfa[y] = round(probabilities[y] * block) + numIterPerAlfaPrevious;
-                numIterPerAlfaPrevious = numIterPerAlfa[y];
-            }
-            numIterPerAlfa[tam - 1] = block;
-            alfa = vetAlfas[auxChooseAlfa];
+            stopped.store(true, memory_order_relaxed);
+            return;
+        }
+        blockBuilt[i] = true;
+
+        RANDOM_STREAM stream;
+        xrandomize_stream(&stream, seed, z);
+        SolverWorkspace *workspace = workspaces[thread];
+        this->randomizedConstruction(vetAlfas[blockAlfas[i]], coverageKernel, heuristics, weights, workspace, &stream);
+        numberIterations++;
+        // Uma construção repetida não entra nas médias; durante o bloco, só as dos blocos anteriores são consultadas
+        blockHashes[i] = workspace->getSolutionHash();
+        if (constructions->contains(blockHashes[i]))
+        {
+            blockBuilt[i] = false;
+            numberDuplicates++;
+            return;
         }
+        blockCosts[i] = workspace->improveSolution();
 
-        // Escolher o alfa
-        if (counterChooseAlfa == numIterPerAlfa[auxChooseAlfa])
+        // Religa o ótimo local a uma solução elite sorteada; o conjunto só muda entre os blocos
+        blockFinalCosts[i] = blockCosts[i];
+        if (elitePool->getNumberSolutions() > 0)
+        {
+            int elite = xrandom_stream(&stream, elitePool->getNumberSolutions());
+            blockFinalCosts[i] = workspace->relinkSolution(elitePool->getSolution(elite), elitePool->getSolutionSize(elite), blockCosts[i]);
+            if (blockFinalCosts[i] < blockCosts[i])
+                numberRelinked++;
+        }
+        if (elitePool->getCapacity() > 0)
         {
-            auxChooseAlfa++;
-            alfa = vetAlfas[auxChooseAlfa];
+            blockSolutionSizes[i] = workspace->getSolutionSize();
+            copy(workspace->getSolution(), workspace->getSolution() + blockSolutionSizes[i], blockSolutions[i]);
         }
-        (iterEachAlfa[auxChooseAlfa])++;
 
-        // Auxiliares para uma solução
-        float currentTotalCost = 0;
-        list<SimpleNode> solutionSet;
-        int candidates;
-        bool *nodeCovered;
-        Node **nodeList = this->copyNodePointersToArray(&candidates, &nodeCovered);
+        // Guarda a nova solução se for melhor que a anterior da thread
+        unsigned long long key = solutionKey(blockFinalCosts[i], z);
+        workspace->keepIfBest(key);
+        updateBestKey(&bestKey, key);
+    };
 
-        while (candidates > 0)
+    for (blockStart = 0; blockStart < numIterations && !stopped.load(); blockStart += block)
+    {
+        int blockSize = min(block, numIterations - blockStart);
+
+        // Divide o bloco entre os alfas
+        updateProbabilities(probabilities, averages, *totalCost, tam);
+        int numIterPerAlfaPrevious = 0;
+        for (int y = 0; y < tam - 1; y++)
         {
-            // Seleciona um dentre os melhores nós
-            this->sortNodesByDegreeAndWeight(nodeList, candidates);
-            int randomPosition = xrandom(ceil(candidates * alfa)); // 0 a teto da seleção (excluído)
-            int randomIndex = candidates - 1 - randomPosition;
-            int bestId = nodeList[randomIndex]->getId();
-            // printList(nodeList, candidates);
-            // cout << "Escolhido: " << nodeList[randomIndex]->getLabel()
-            //      << endl;
-
-            // Adiciona à solução
-            SimpleNode simpleNode;
-            simpleNode.id = bestId;
-            simpleNode.label = nodeList[randomIndex]->getLabel();
-            simpleNode.degree = nodeList[randomIndex]->getInDegree();
-            simpleNode.weight = nodeList[randomIndex]->getWeight();
-            solutionSet.emplace_back(simpleNode);
-            currentTotalCost += simpleNode.weight;
-            nodeCovered[bestId] = true;
-
-            // Marca nós ligados como cobertos
-            for (Edge *e = nodeList[randomIndex]->getFirstEdge(); e != nullptr; e = e->getNextEdge())
-            {
-                int targetId = e->getTargetId();
-                nodeCovered[targetId] = true;
-            }
+            numIterPerAlfa[y] = round(probabilities[y] * block) + numIterPerAlfaPrevious;
+            numIterPerAlfaPrevious = numIterPerAlfa[y];
+        }
+        numIterPerAlfa[tam - 1] = block;
+        int auxChooseAlfa = 0;
+        for (int i = 0; i < blockSize; i++)
+        {
+            if (i == numIterPerAlfa[auxChooseAlfa])
+                auxChooseAlfa++;
+            blockAlfas[i] = auxChooseAlfa;
+        }
 
-            // Remove nós cobertos
-            int k = 0;
-            for (int n = 0; n < candidates; n++)
+        // Constrói as soluções do bloco
+        parallelFor(blockSize, numThreads, buildSolution);
+
+        // Agrega os custos do bloco (antes do religamento) às médias de cada alfa e atualiza o conjunto elite
+        for (int i = 0; i < blockSize; i++)
+        {
+            if (!blockBuilt[i])
+                continue;
+            // Repetição de uma iteração anterior do mesmo bloco, atribuída à de maior índice
+            if (!constructions->insert(blockHashes[i]))
             {
-                if (nodeCovered[nodeList[n + k]->getId()])
-                {
-                    candidates--;
-                    k++;
-                    n--;
-                }
-                else
-                    nodeList[n] = nodeList[n + k];
+                numberDuplicates++;
+                continue;
             }
-            // printList(nodeList, candidates);
-            // cout << "=-=-=" << endl;
-
-            // Verifica cobertura total
-            if (isSolved(nodeList, nodeCovered, candidates))
-                break;
+            (iterEachAlfa[blockAlfas[i]])++;
+            updateAverages(vetAlfas, averages, iterEachAlfa, tam, blockCosts[i], blockAlfas[i]);
+            if (blockFinalCosts[i] < *totalCost)
+                *totalCost = blockFinalCosts[i];
+            elitePool->insert(blockSolutions[i], blockSolutionSizes[i], blockFinalCosts[i]);
         }
+    }
 
-        updateAverages(vetAlfas, averages, iterEachAlfa, tam, currentTotalCost, auxChooseAlfa);
-        counterChooseAlfa++;
-
-        // Verifica se a nova solução gerada é melhor que a anterior
-        if (currentTotalCost < *totalCost)
+    // Recupera a solução da thread que detém o mínimo global; o custo informado é o dela, que pode vir de
+    // uma repetição do mesmo bloco, descartada das médias mas já religada e guardada durante o bloco
+    list<SimpleNode> bestSolutionSet;
+    for (int t = 0; t < numThreads; t++)
+        if (workspaces[t]->getBestKey() == bestKey.load() && workspaces[t]->getBestKey() != ULLONG_MAX)
         {
-            // Atualiza a lista da melhor solução;
-            *totalCost = currentTotalCost;
-            bestSolutionSet.clear();
-            for (auto &&node : solutionSet)
-                bestSolutionSet.emplace_back(node);
+            bestSolutionSet = this->createSolutionList(workspaces[t]->getBestSolution(), workspaces[t]->getBestSolutionSize(), nodeList);
+            *totalCost = 0;
+            for (auto &&node : bestSolutionSet)
+                *totalCost += node.weight;
         }
 
-        // Limpa a memória
-        delete[] nodeList;
-        delete[] nodeCovered;
-
-        // cout << "\nCusto: " << *totalCost << "\n==========" << endl
-        //      << endl;
-    }
-
     int greatestProbabilityIndex = 0;
     for (int i = 1; i < tam; i++)
     {
@@ -1270,11 +2018,144 @@ list<SimpleNode> Graph ::dominatingSetWeightedRandomizedReactive(float *totalCos
     }
     *bestAlfa = vetAlfas[greatestProbabilityIndex];
 
+    if (statistics != nullptr)
+    {
+        statistics->numberIterations = numberIterations.load();
+        statistics->numberDuplicates = numberDuplicates.load();
+        statistics->numberRelinked = numberRelinked.load();
+        statistics->lowerBound = lowerBound;
+    }
+
     // Limpa a memória
     delete[] iterEachAlfa;
     delete[] probabilities;
     delete[] numIterPerAlfa;
     delete[] averages;
+    delete[] blockAlfas;
+    delete[] blockCosts;
+    delete[] blockBuilt;
+    delete[] blockHashes;
+    delete[] blockFinalCosts;
+    delete[] blockSolutionSizes;
+    for (int i = 0; i < block; i++)
+        delete[] blockSolutions[i];
+    delete[] blockSolutions;
+    delete elitePool;
+    for (int t = 0; t < numThreads; t++)
+        delete workspaces[t];
+    delete[] workspaces;
+    delete constructions;
+    delete coverageKernel;
+    if (reverseGraph != forwardGraph)
+        delete reverseGraph;
+    delete forwardGraph;
+    delete[] weights;
+    delete[] heuristics;
+    delete[] nodeList;
+
+    return bestSolutionSet;
+}
+
+/****************
+ * Funcao    : list<SimpleNode> dominatingSetIteratedGreedy(float *totalCost, CARDINAL seed, int numIterations, float destroyFraction, int numThreads, StoppingCriteria *stoppingCriteria, SearchStatistics *statistics)*
+ * Descricao : Encontra um subconjunto dominante ponderado com um guloso iterado com lista tabu. Em vez de recomeçar  *
+ *             do zero como o GRASP, cada iteração parte da solução corrente: retira uma região dos seus nós, que   *
+ *             ficam tabu, reconstrói a cobertura gulosamente e aplica a busca local; uma solução pior é aceita     *
+ *             com probabilidade decrescente com a piora. Cada thread                                                *
+ *             executa uma cadeia independente a partir da solução do guloso de ganho dinâmico, com o seu próprio   *
+ *             fluxo de números aleatórios (derivado da semente e do índice da cadeia); o resultado é a melhor      *
+ *             solução entre as cadeias, e a execução para quando alguma cadeia alcança o limite inferior.         *
+ * Parametros: totalCost - custo total da solução                                                                      *
+               seed - semente de randomização                                                                         *
+               numIterations - número máximo de iterações de cada cadeia                                              *
+               destroyFraction - fração dos nós da solução retirados a cada iteração                                  *
+               numThreads - quantidade de threads (e de cadeias); valores <= 0 usam todos os núcleos                   *
+               stoppingCriteria - critérios de parada antecipada; nullptr executa todas as iterações                  *
+               statistics - endereço das estatísticas da execução; nullptr não as informa                            *
+ * Retorno   : Retorna uma lista de nós solução.                                                                      *
+ ***************/
+list<SimpleNode> Graph::dominatingSetIteratedGreedy(float *totalCost, CARDINAL seed, int numIterations, float destroyFraction, int numThreads, StoppingCriteria *stoppingCriteria, SearchStatistics *statistics)
+{
+    numThreads = resolveThreads(numThreads);
+    double startTime = wallClock();
+
+    // Adjacências, pesos e limite inferior compartilhados pelas cadeias
+    int size;
+    Node **nodeList = this->copyNodePointersToArray(&size);
+    float *weights = new float[size];
+    for (int i = 0; i < size; i++)
+        weights[i] = nodeList[i]->getWeight();
+    CompactGraph *forwardGraph = new CompactGraph(this, false);
+    CompactGraph *reverseGraph = this->directed ? new CompactGraph(this, true) : forwardGraph;
+    DominatingSetLowerBound *dominatingSetLowerBound = new DominatingSetLowerBound(forwardGraph, reverseGraph, weights);
+    float lowerBound = dominatingSetLowerBound->compute(LOWER_BOUND_SWEEPS);
+    delete dominatingSetLowerBound;
+
+    // Solução inicial do guloso de ganho dinâmico
+    float initialCost = 0;
+    list<SimpleNode> initialSet = this->dominatingSetWeightedDynamic(&initialCost);
+    int initialSize = 0;
+    int *initialSolution = new int[size > 0 ? size : 1];
+    for (auto &&node : initialSet)
+        initialSolution[initialSize++] = node.id;
+    int numberDestroyed = max(1, (int)ceil(destroyFraction * initialSize));
+    int tabuTenure = TABU_TENURE_FACTOR * numberDestroyed;
+
+    IteratedGreedy **searches = new IteratedGreedy *[numThreads];
+    atomic<bool> stopped(false);
+    atomic<int> numberIterations(0);
+    parallelFor(numThreads, numThreads, [&](int chain, int /*thread*/)
+                {
+        IteratedGreedy *search = new IteratedGreedy(forwardGraph, reverseGraph, weights);
+        searches[chain] = search;
+        search->start(initialSolution, initialSize);
+        RANDOM_STREAM stream;
+        xrandomize_stream(&stream, seed, chain);
+
+        int bestIteration = 0;
+        for (int z = 0; z < numIterations; z++)
+        {
+            unsigned long long chainKey = solutionKey(search->getBestCost(), bestIteration);
+            if (stopped.load(memory_order_relaxed) || stopRequested(stoppingCriteria, startTime, chainKey, z, lowerBound))
+                break;
+            if (search->iterate(numberDestroyed, tabuTenure, z + 1, &stream))
+                bestIteration = z;
+            numberIterations++;
+        }
+
+        // Uma solução ótima ou com o custo alvo encerra as outras cadeias
+        if (search->getBestCost() <= lowerBound + 1e-3f ||
+            (stoppingCriteria != nullptr && stoppingCriteria->targetCost >= 0 && search->getBestCost() <= stoppingCriteria->targetCost))
+            stopped.store(true, memory_order_relaxed); });
+
+    // Melhor solução entre as cadeias, com empate pela de menor índice
+    int bestChain = 0;
+    for (int chain = 1; chain < numThreads; chain++)
+        if (searches[chain]->getBestCost() < searches[bestChain]->getBestCost())
+            bestChain = chain;
+    list<SimpleNode> bestSolutionSet = this->createSolutionList(searches[bestChain]->getBestSolution(), searches[bestChain]->getBestSolutionSize(), nodeList);
+    *totalCost = 0;
+    for (auto &&node : bestSolutionSet)
+        *totalCost += node.weight;
+
+    if (statistics != nullptr)
+    {
+        statistics->numberIterations = numberIterations.load();
+        statistics->numberDuplicates = 0;
+        statistics->numberRelinked = 0;
+        statistics->lowerBound = lowerBound;
+    }
+
+    // Limpa a memória
+    for (int chain = 0; chain < numThreads; chain++)
+        delete searches[chain];
+    delete[] searches;
+    delete[] initialSolution;
+    if (reverseGraph != forwardGraph)
+        delete reverseGraph;
+    delete forwardGraph;
+    delete[] weights;
+    delete[] nodeList;
 
     return bestSolutionSet;
 }
@@ -1315,21 +2196,18 @@ void Graph ::initializeProbabilities(int **iterEachAlfa, float **probabilities,
  ***************/
 void Graph::updateProbabilities(float probabilities[], float averages[], float bestCost, int tam)
 {
-    float *q = new float[tam];
-
+    // Os valores q de cada alfa são calculados no próprio vetor de probabilidades
     for (int i = 0; i < tam; i++)
     {
-        q[i] = bestCost / averages[i];
+        probabilities[i] = bestCost / averages[i];
     }
 
     float qSum = 0;
     for (int j = 0; j < tam; j++)
-        qSum += q[j];
+        qSum += probabilities[j];
 
     for (int i = 0; i < tam; i++)
-        probabilities[i] = q[i] / qSum;
-
-    delete[] q;
+        probabilities[i] = probabilities[i] / qSum;
 }
 
 /****************
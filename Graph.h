@@ -6,10 +6,35 @@
 #define GRAPH_H_INCLUDED
 #include "Node.h"
 #include "random/random.h"
+#include <atomic>
 #include <iostream>
 
 using namespace std;
 
+class DiskDistanceMatrix;
+class DynamicMST;
+class CoverageKernel;
+class SolverWorkspace;
+
+// Critérios de parada do GRASP, além do número máximo de iterações; a execução termina no primeiro
+// critério atingido
+typedef struct
+{
+    double timeLimit;       // tempo de relógio em segundos (<= 0 desativa)
+    float targetCost;       // custo alvo (< 0 desativa)
+    int maxStagnation;      // iterações seguidas sem melhora (<= 0 desativa)
+    atomic<bool> *cancelled; // sinal externo de cancelamento (nullptr desativa)
+} StoppingCriteria;
+
+// Estatísticas de uma execução do GRASP
+typedef struct
+{
+    int numberIterations; // iterações construídas antes da parada
+    int numberDuplicates; // construções repetidas, descartadas sem busca local
+    int numberRelinked;   // religamentos de caminhos que melhoraram o ótimo local da iteração
+    float lowerBound;     // limite inferior lagrangiano calculado pelo driver para a parada
+} SearchStatistics;
+
 class Graph
 {
     // Atributos
@@ -22,6 +47,7 @@ private:
     Node *firstNode;
     Node *lastNode;
     int nodeIdCounter;
+    DynamicMST *dynamicMST;
 
 public:
     // Construtor
@@ -39,6 +65,7 @@ public:
     bool getWeightedNode();
     Node *getFirstNode();
     Node *getLastNode();
+    DynamicMST *getDynamicMST();
 
     // Métodos de manipulação
     Node *insertNode(int label);
@@ -65,11 +92,15 @@ public:
     void printList(Node **nodeList, int size);
     bool isSolved(Node **nodeList, bool *nodeCovered, int size);
     Node **copyNodePointersToArray(int *size, bool **coveredList);
+    Node **copyNodePointersToArray(int *size);
 
     void sortNodesByDegreeAndWeight(Node **nodeList, int size);
     list<SimpleNode> dominatingSetWeighted(float *totalCost);
-    list<SimpleNode> dominatingSetWeightedRandomized(float *totalCost, CARDINAL seed, int numIterations, float alfa);
-    list<SimpleNode> dominatingSetWeightedRandomizedReactive(float *totalCost, CARDINAL seed, int numIterations, float *vetAlfas, int tam, int block, float *bestAlfa);
+    list<SimpleNode> dominatingSetWeightedDynamic(float *totalCost);
+    float dominatingSetLowerBound();
+    list<SimpleNode> dominatingSetWeightedRandomized(float *totalCost, CARDINAL seed, int numIterations, float alfa, int numThreads, StoppingCriteria *stoppingCriteria, SearchStatistics *statistics);
+    list<SimpleNode> dominatingSetWeightedRandomizedReactive(float *totalCost, CARDINAL seed, int numIterations, float *vetAlfas, int tam, int block, float *bestAlfa, int eliteSize, int numThreads, StoppingCriteria *stoppingCriteria, SearchStatistics *statistics);
+    list<SimpleNode> dominatingSetIteratedGreedy(float *totalCost, CARDINAL seed, int numIterations, float destroyFraction, int numThreads, StoppingCriteria *stoppingCriteria, SearchStatistics *statistics);
 
     void initializeProbabilities(int **iterEachAlfa, float **probabilities, int **numIterPerAlfa, float **averages, int tam);
     void updateProbabilities(float probabilities[], float averages[], float bestCost, int tam);
@@ -77,13 +108,26 @@ public:
 
     // Algoritmos predefinidos
     float **floydMarshall();
+    float **allPairsShortestPaths(int numThreads);
+    DiskDistanceMatrix *allPairsShortestPathsOnDisk(string path, size_t memoryBudget, int numThreads);
     float *dijkstra(int startId);
     Graph *kruskal();
     Graph *prim();
+    Graph *boruvka(int numThreads);
+    DynamicMST *attachDynamicMST();
 
 private:
     // Métodos auxiliares
     bool depthFirstSearchAux(Node *currentNode, int targetId, bool visitedList[]);
+    float **createDistanceMatrix(int *stride);
+    SimpleEdge *createEdgeArray(int *numEdges);
+    void sortEdgesByWeight(SimpleEdge *edges, int numEdges, int *sortedOrder);
+    Graph *createGraphFromEdges(SimpleEdge *edges, int numEdges);
+    void notifyDynamicMST(Node *sourceNode, Node *targetNode, float weight);
+    void rebuildDynamicMST();
+    int selectRestrictedCandidate(int *candidates, int numCandidates, int rclSize, int rank, const float *scores);
+    float randomizedConstruction(float alfa, CoverageKernel *coverageKernel, const float *heuristics, const float *weights, SolverWorkspace *workspace, RANDOM_STREAM *stream);
+    list<SimpleNode> createSolutionList(int *solution, int solutionSize, Node **nodeList);
 };
 
 #endif // GRAPH_H_INCLUDED
@@ -0,0 +1,224 @@
+#include "IndexedHeap.h"
+
+using namespace std;
+
+/**************************************************************************************************
+ * Defining the IndexedHeap's methods
+ **************************************************************************************************/
+
+// Construtor
+IndexedHeap::IndexedHeap(int capacity) : IndexedHeap(capacity, false)
+{
+}
+IndexedHeap::IndexedHeap(int capacity, bool maxHeap)
+{
+    this->capacity = capacity;
+    this->maxHeap = maxHeap;
+    this->size = 0;
+    this->items = new int[capacity];
+    this->positions = new int[capacity];
+    this->keys = new float[capacity];
+    for (int i = 0; i < capacity; i++)
+        this->positions[i] = -1;
+}
+
+// Destrutor
+IndexedHeap::~IndexedHeap()
+{
+    delete[] this->items;
+    delete[] this->positions;
+    delete[] this->keys;
+    this->items = nullptr;
+    this->positions = nullptr;
+    this->keys = nullptr;
+    this->capacity = 0;
+    this->size = 0;
+}
+
+// Getters
+int IndexedHeap::getSize()
+{
+    return this->size;
+}
+float IndexedHeap::getKey(int item)
+{
+    return this->keys[item];
+}
+
+// Métodos de manipulação
+//
+
+/****************
+ * Funcao    : void push(int item, float key)                           *
+ * Descricao : Insere um item, que ainda não está no heap, com sua chave *
+ * Parametros: item - item a ser inserido                               *
+ *             key - chave do item                                      *
+ * Retorno   : Sem retorno.                                             *
+ ***************/
+void IndexedHeap::push(int item, float key)
+{
+    this->keys[item] = key;
+    this->items[this->size] = item;
+    this->positions[item] = this->size;
+    this->size++;
+    this->siftUp(this->size - 1);
+}
+
+/****************
+ * Funcao    : void decreaseKey(int item, float key)                    *
+ * Descricao : Diminui a chave de um item presente no heap              *
+ * Parametros: item - item a ser atualizado                             *
+ *             key - nova chave, menor ou igual à atual                 *
+ * Retorno   : Sem retorno.                                             *
+ ***************/
+void IndexedHeap::decreaseKey(int item, float key)
+{
+    this->keys[item] = key;
+    this->siftUp(this->positions[item]);
+}
+
+/****************
+ * Funcao    : void updateKey(int item, float key)                      *
+ * Descricao : Altera a chave de um item presente no heap, em qualquer  *
+ *             direção                                                  *
+ * Parametros: item - item a ser atualizado                             *
+ *             key - nova chave                                         *
+ * Retorno   : Sem retorno.                                             *
+ ***************/
+void IndexedHeap::updateKey(int item, float key)
+{
+    this->keys[item] = key;
+    this->siftUp(this->positions[item]);
+    this->siftDown(this->positions[item]);
+}
+
+/****************
+ * Funcao    : void remove(int item)                                    *
+ * Descricao : Remove um item qualquer presente no heap                 *
+ * Parametros: item - item a ser removido                               *
+ * Retorno   : Sem retorno.                                             *
+ ***************/
+void IndexedHeap::remove(int item)
+{
+    int position = this->positions[item];
+    this->size--;
+    this->positions[item] = -1;
+    if (position < this->size)
+    {
+        int lastItem = this->items[this->size];
+        this->items[position] = lastItem;
+        this->positions[lastItem] = position;
+        this->siftUp(position);
+        this->siftDown(this->positions[lastItem]);
+    }
+}
+
+/****************
+ * Funcao    : int peek()                                               *
+ * Descricao : Consulta o item do topo (menor chave, ou maior no heap   *
+ *             de máximo) sem removê-lo                                 *
+ * Parametros: Sem parâmetros.                                          *
+ * Retorno   : Retorna o item do topo do heap.                          *
+ ***************/
+int IndexedHeap::peek()
+{
+    return this->items[0];
+}
+
+/****************
+ * Funcao    : int pop()                                                *
+ * Descricao : Remove o item do topo do heap                           *
+ * Parametros: Sem parâmetros.                                          *
+ * Retorno   : Retorna o item removido.                                 *
+ ***************/
+int IndexedHeap::pop()
+{
+    int top = this->items[0];
+    this->size--;
+    this->positions[top] = -1;
+    if (this->size > 0)
+    {
+        this->items[0] = this->items[this->size];
+        this->positions[this->items[0]] = 0;
+        this->siftDown(0);
+    }
+    return top;
+}
+
+/****************
+ * Funcao    : void clear()                                                     *
+ * Descricao : Esvazia o heap em tempo proporcional à quantidade de itens nele   *
+ * Parametros: Sem parâmetros.                                                  *
+ * Retorno   : Sem retorno.                                                     *
+ ***************/
+void IndexedHeap::clear()
+{
+    for (int i = 0; i < this->size; i++)
+        this->positions[this->items[i]] = -1;
+    this->size = 0;
+}
+
+// Métodos auxiliares
+//
+
+bool IndexedHeap::isEmpty()
+{
+    return this->size == 0;
+}
+bool IndexedHeap::contains(int item)
+{
+    return this->positions[item] >= 0;
+}
+
+/****************
+ * Funcao    : bool precedes(int firstItem, int secondItem)                                     *
+ * Descricao : Compara dois itens pela chave, desempatando pelo item para manter determinismo;   *
+ *             no heap de máximo, as duas comparações se invertem                               *
+ * Parametros: firstItem - primeiro item                                                        *
+ *             secondItem - segundo item                                                        *
+ * Retorno   : Retorna true se o primeiro item deve ficar acima do segundo.                     *
+ ***************/
+bool IndexedHeap::precedes(int firstItem, int secondItem)
+{
+    float firstKey = this->keys[firstItem];
+    float secondKey = this->keys[secondItem];
+    if (firstKey != secondKey)
+        return this->maxHeap ? firstKey > secondKey : firstKey < secondKey;
+    return this->maxHeap ? firstItem > secondItem : firstItem < secondItem;
+}
+
+void IndexedHeap::siftUp(int position)
+{
+    int item = this->items[position];
+    while (position > 0)
+    {
+        int parent = (position - 1) / 2;
+        if (!this->precedes(item, this->items[parent]))
+            break;
+        this->items[position] = this->items[parent];
+        this->positions[this->items[position]] = position;
+        position = parent;
+    }
+    this->items[position] = item;
+    this->positions[item] = position;
+}
+
+void IndexedHeap::siftDown(int position)
+{
+    int item = this->items[position];
+    while (true)
+    {
+        int child = 2 * position + 1;
+        if (child >= this->size)
+            break;
+        if (child + 1 < this->size && this->precedes(this->items[child + 1], this->items[child]))
+            child++;
+        if (!this->precedes(this->items[child], item))
+            break;
+        this->items[position] = this->items[child];
+        this->positions[this->items[position]] = position;
+        position = child;
+    }
+    this->items[position] = item;
+    this->positions[item] = position;
+}
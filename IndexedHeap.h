@@ -0,0 +1,54 @@
+/**************************************************************************************************
+ * Implementation of the TAD IndexedHeap
+ **************************************************************************************************/
+
+#ifndef INDEXEDHEAP_H_INCLUDED
+#define INDEXEDHEAP_H_INCLUDED
+
+using namespace std;
+
+// Heap binário de mínimo (ou de máximo) sobre os itens 0..capacity-1, com posição de cada item indexada
+class IndexedHeap
+{
+    // Atributos
+private:
+    int capacity;
+    bool maxHeap;
+    int size;
+    int *items;
+    int *positions;
+    float *keys;
+
+public:
+    // Construtor
+    IndexedHeap(int capacity);
+    IndexedHeap(int capacity, bool maxHeap);
+
+    // Destrutor
+    ~IndexedHeap();
+
+    // Getters
+    int getSize();
+    float getKey(int item);
+
+    // Métodos de manipulação
+    void push(int item, float key);
+    int peek();
+    void decreaseKey(int item, float key);
+    void updateKey(int item, float key);
+    void remove(int item);
+    int pop();
+    void clear();
+
+    // Métodos auxiliares
+    bool isEmpty();
+    bool contains(int item);
+
+private:
+    // Métodos auxiliares
+    bool precedes(int firstItem, int secondItem);
+    void siftUp(int position);
+    void siftDown(int position);
+};
+
+#endif // INDEXEDHEAP_H_INCLUDED
@@ -0,0 +1,470 @@
+#include "IteratedGreedy.h"
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
+using namespace std;
+
+// Temperatura do critério de aceitação, em frações do peso médio dos nós da solução inicial
+static const double ACCEPTANCE_TEMPERATURE = 0.3;
+// Resolução do sorteio de aceitação
+static const int ACCEPTANCE_RESOLUTION = 1 << 30;
+
+/**************************************************************************************************
+ * Defining the IteratedGreedy's methods
+ **************************************************************************************************/
+
+/****************
+ * Funcao    : IteratedGreedy(CompactGraph *forwardGraph, CompactGraph *reverseGraph, const float *weights)   *
+ * Descricao : Aloca os contadores de cobertura, os ganhos e as soluções corrente e melhor                  *
+ * Parametros: forwardGraph - adjacências de saída (nós cobertos por cada nó)                              *
+ *             reverseGraph - adjacências de entrada (nós que cobrem cada nó); em grafos não direcionados  *
+ *                            pode ser o próprio forwardGraph                                              *
+ *             weights - peso de cada nó, indexado pelo id                                                 *
+ ***************/
+IteratedGreedy::IteratedGreedy(CompactGraph *forwardGraph, CompactGraph *reverseGraph, const float *weights)
+{
+    this->size = forwardGraph->getSize();
+    this->forwardGraph = forwardGraph;
+    this->reverseGraph = reverseGraph;
+    this->weights = weights;
+    this->coverCounts = new int[this->size];
+    this->gains = new int[this->size];
+    this->positions = new int[this->size];
+    this->solution = new int[this->size];
+    this->uncoveredNodes = new int[this->size];
+    this->uncoveredPositions = new int[this->size];
+    this->tabuUntil = new int[this->size];
+    this->insertedNodes = new int[this->size];
+    this->touchedNodes = new int[this->size];
+    this->touchedFromSolution = new bool[this->size];
+    this->touchMarks = new int[this->size];
+    this->candidateHeap = new IndexedHeap(this->size, true);
+    this->tabuHeap = new IndexedHeap(this->size, true);
+    this->marks = new int[this->size];
+    this->candidates = new int[this->size];
+    this->bestSolution = new int[this->size];
+    // A busca local trabalha sobre os contadores e as posições desta instância
+    this->localSearch = new LocalSearch(forwardGraph, reverseGraph, weights, this->coverCounts, this->positions);
+    for (int i = 0; i < this->size; i++)
+    {
+        this->coverCounts[i] = 0;
+        this->positions[i] = -1;
+        this->tabuUntil[i] = 0;
+        this->touchMarks[i] = 0;
+        this->marks[i] = 0;
+    }
+    this->solutionSize = this->bestSolutionSize = 0;
+    this->numberUncovered = this->numberInserted = this->numberTouched = 0;
+    this->currentMark = this->currentTouch = 0;
+    this->cost = 0;
+    this->temperature = 0;
+    this->bestCost = FLT_MAX;
+}
+
+// Destrutor
+IteratedGreedy::~IteratedGreedy()
+{
+    delete[] this->coverCounts;
+    delete[] this->gains;
+    delete[] this->positions;
+    delete[] this->solution;
+    delete[] this->uncoveredNodes;
+    delete[] this->uncoveredPositions;
+    delete[] this->tabuUntil;
+    delete[] this->insertedNodes;
+    delete[] this->touchedNodes;
+    delete[] this->touchedFromSolution;
+    delete[] this->touchMarks;
+    delete this->candidateHeap;
+    delete this->tabuHeap;
+    delete[] this->marks;
+    delete[] this->candidates;
+    delete[] this->bestSolution;
+    delete this->localSearch;
+    this->coverCounts = this->gains = this->positions = this->solution = nullptr;
+    this->uncoveredNodes = this->uncoveredPositions = this->tabuUntil = this->insertedNodes = nullptr;
+    this->touchedNodes = this->touchMarks = this->marks = this->candidates = this->bestSolution = nullptr;
+    this->touchedFromSolution = nullptr;
+    this->candidateHeap = this->tabuHeap = nullptr;
+    this->localSearch = nullptr;
+    this->forwardGraph = this->reverseGraph = nullptr;
+    this->weights = nullptr;
+    this->size = 0;
+}
+
+// Getters
+int IteratedGreedy::getSize()
+{
+    return this->size;
+}
+int *IteratedGreedy::getBestSolution()
+{
+    return this->bestSolution;
+}
+int IteratedGreedy::getBestSolutionSize()
+{
+    return this->bestSolutionSize;
+}
+float IteratedGreedy::getBestCost()
+{
+    return this->bestCost;
+}
+
+// Métodos de manipulação
+//
+
+/****************
+ * Funcao    : void start(const int *initialSolution, int initialSize)                          *
+ * Descricao : Leva a solução inicial a um ótimo local e a adota como solução corrente e melhor; *
+ *             a temperatura da aceitação é proporcional ao peso médio dos nós dessa solução.   *
+ *             Os contadores são calculados aqui uma única vez e mantidos pelas iterações.      *
+ * Parametros: initialSolution - ids dos nós de uma solução dominante                           *
+ *             initialSize - quantidade de nós da solução                                      *
+ * Retorno   : Sem retorno.                                                                    *
+ ***************/
+void IteratedGreedy::start(const int *initialSolution, int initialSize)
+{
+    for (int i = 0; i < initialSize; i++)
+        this->solution[i] = initialSolution[i];
+    this->solutionSize = initialSize;
+    // A passada completa da busca local devolve os contadores zerados, e só então eles são carregados
+    this->localSearch->improve(this->solution, &this->solutionSize);
+    this->loadSolution();
+    this->saveBest();
+    this->temperature = ACCEPTANCE_TEMPERATURE * this->cost / max(this->solutionSize, 1);
+}
+
+/****************
+ * Funcao    : bool iterate(int numberDestroyed, int tabuTenure, int iteration, RANDOM_STREAM *stream)       *
+ * Descricao : Executa uma iteração: retira uma região da solução corrente, cujos nós ficam tabu por         *
+ *             tabuTenure iterações, reconstrói a cobertura, remove os nós redundantes e retoma a busca      *
+ *             local ao redor dos nós que mudaram. Uma solução não pior que a corrente é aceita; uma pior,   *
+ *             com probabilidade que decai exponencialmente com a piora; as demais são desfeitas pelo        *
+ *             registro dos nós alterados na iteração, sem percorrer o grafo.                               *
+ * Parametros: numberDestroyed - quantidade de nós retirados                                                  *
+ *             tabuTenure - iterações em que um nó retirado não pode voltar à solução                         *
+ *             iteration - índice da iteração                                                                  *
+ *             stream - fluxo de números aleatórios da thread                                                 *
+ * Retorno   : Retorna true se a iteração encontrou uma nova melhor solução.                                  *
+ ***************/
+bool IteratedGreedy::iterate(int numberDestroyed, int tabuTenure, int iteration, RANDOM_STREAM *stream)
+{
+    double previousCost = this->cost;
+    this->currentTouch++;
+    this->numberTouched = 0;
+
+    // Destruição e reconstrução
+    this->destroy(numberDestroyed, tabuTenure, iteration, stream);
+    this->repair(iteration);
+    this->removeRedundantNodes();
+
+    // A busca local parte dos nós alterados, e os que ela muda também entram no registro
+    int numberSeeds = this->numberTouched;
+    this->cost += this->localSearch->improveRegion(this->solution, &this->solutionSize, this->touchedNodes, numberSeeds);
+    int *changedNodes = this->localSearch->getChangedNodes();
+    bool *changedFromSolution = this->localSearch->getChangedFromSolution();
+    for (int i = 0; i < this->localSearch->getNumberChanged(); i++)
+        this->recordTouch(changedNodes[i], changedFromSolution[i]);
+
+    if (this->cost < this->bestCost - 1e-4)
+    {
+        this->saveBest();
+        return true;
+    }
+
+    // Critério de aceitação
+    double worsening = this->cost - previousCost;
+    if (worsening > 1e-4 && xrandom_stream(stream, ACCEPTANCE_RESOLUTION) >= ACCEPTANCE_RESOLUTION * exp(-worsening / this->temperature))
+        this->undoIteration();
+    return false;
+}
+
+// Métodos auxiliares
+//
+
+// Recalcula contadores, ganhos, nós descobertos e custo a partir dos nós da solução corrente
+void IteratedGreedy::loadSolution()
+{
+    int *offsets = this->forwardGraph->getOffsets();
+    int numberNodes = this->solutionSize;
+    for (int i = 0; i < numberNodes; i++)
+        this->candidates[i] = this->solution[i];
+
+    this->solutionSize = 0;
+    this->numberUncovered = this->size;
+    this->cost = 0;
+    for (int i = 0; i < this->size; i++)
+    {
+        this->coverCounts[i] = 0;
+        this->positions[i] = -1;
+        this->gains[i] = offsets[i + 1] - offsets[i] + 1;
+        this->uncoveredNodes[i] = i;
+        this->uncoveredPositions[i] = i;
+    }
+    for (int i = 0; i < numberNodes; i++)
+        this->insertNode(this->candidates[i]);
+}
+
+/****************
+ * Funcao    : void insertNode(int nodeId)                                                       *
+ * Descricao : Coloca um nó na solução; cada nó que deixa de estar descoberto reduz o ganho de   *
+ *             todos os nós que o cobrem, atualizados nos heaps da reconstrução                  *
+ * Parametros: nodeId - id do nó                                                                 *
+ * Retorno   : Sem retorno.                                                                     *
+ ***************/
+void IteratedGreedy::insertNode(int nodeId)
+{
+    int *offsets = this->forwardGraph->getOffsets();
+    int *targets = this->forwardGraph->getTargets();
+    int *reverseOffsets = this->reverseGraph->getOffsets();
+    int *reverseTargets = this->reverseGraph->getTargets();
+
+    this->recordTouch(nodeId, false);
+    this->solution[this->solutionSize] = nodeId;
+    this->positions[nodeId] = this->solutionSize++;
+    this->cost += this->weights[nodeId];
+    for (int e = offsets[nodeId] - 1; e < offsets[nodeId + 1]; e++)
+    {
+        int coveredId = e < offsets[nodeId] ? nodeId : targets[e];
+        if (this->coverCounts[coveredId]++ > 0)
+            continue;
+        int position = this->uncoveredPositions[coveredId];
+        int lastId = this->uncoveredNodes[--this->numberUncovered];
+        this->uncoveredNodes[position] = lastId;
+        this->uncoveredPositions[lastId] = position;
+        for (int r = reverseOffsets[coveredId] - 1; r < reverseOffsets[coveredId + 1]; r++)
+        {
+            int coveringId = r < reverseOffsets[coveredId] ? coveredId : reverseTargets[r];
+            this->gains[coveringId]--;
+            this->updateCandidate(coveringId);
+        }
+    }
+}
+
+/****************
+ * Funcao    : void removeNode(int nodeId)                                                       *
+ * Descricao : Retira um nó da solução; cada nó que fica descoberto aumenta o ganho de todos os  *
+ *             nós que o cobrem                                                                  *
+ * Parametros: nodeId - id do nó                                                                 *
+ * Retorno   : Sem retorno.                                                                     *
+ ***************/
+void IteratedGreedy::removeNode(int nodeId)
+{
+    int *offsets = this->forwardGraph->getOffsets();
+    int *targets = this->forwardGraph->getTargets();
+    int *reverseOffsets = this->reverseGraph->getOffsets();
+    int *reverseTargets = this->reverseGraph->getTargets();
+
+    this->recordTouch(nodeId, true);
+    int position = this->positions[nodeId];
+    int lastId = this->solution[--this->solutionSize];
+    this->solution[position] = lastId;
+    this->positions[lastId] = position;
+    this->positions[nodeId] = -1;
+    this->cost -= this->weights[nodeId];
+    for (int e = offsets[nodeId] - 1; e < offsets[nodeId + 1]; e++)
+    {
+        int coveredId = e < offsets[nodeId] ? nodeId : targets[e];
+        if (--this->coverCounts[coveredId] > 0)
+            continue;
+        this->uncoveredPositions[coveredId] = this->numberUncovered;
+        this->uncoveredNodes[this->numberUncovered++] = coveredId;
+        for (int r = reverseOffsets[coveredId] - 1; r < reverseOffsets[coveredId + 1]; r++)
+            this->gains[r < reverseOffsets[coveredId] ? coveredId : reverseTargets[r]]++;
+    }
+}
+
+// Registra a primeira mudança de um nó na iteração, com a sua pertinência à solução antes dela
+void IteratedGreedy::recordTouch(int nodeId, bool fromSolution)
+{
+    if (this->touchMarks[nodeId] == this->currentTouch)
+        return;
+    this->touchMarks[nodeId] = this->currentTouch;
+    this->touchedFromSolution[this->numberTouched] = fromSolution;
+    this->touchedNodes[this->numberTouched++] = nodeId;
+}
+
+/****************
+ * Funcao    : void undoIteration()                                                                *
+ * Descricao : Restaura a solução do início da iteração a partir do registro dos nós alterados: os  *
+ *             que saíram voltam antes que os que entraram saiam, de modo que nenhum nó fica        *
+ *             descoberto no caminho. Custa O(grau) por nó alterado.                                *
+ * Parametros: Sem parâmetros.                                                                      *
+ * Retorno   : Sem retorno.                                                                        *
+ ***************/
+void IteratedGreedy::undoIteration()
+{
+    for (int i = 0; i < this->numberTouched; i++)
+        if (this->touchedFromSolution[i] && this->positions[this->touchedNodes[i]] == -1)
+            this->insertNode(this->touchedNodes[i]);
+    for (int i = 0; i < this->numberTouched; i++)
+        if (!this->touchedFromSolution[i] && this->positions[this->touchedNodes[i]] != -1)
+            this->removeNode(this->touchedNodes[i]);
+}
+
+// Pontuação GANHO/PESO de um candidato da reconstrução; nós de peso zero vêm primeiro
+float IteratedGreedy::score(int nodeId)
+{
+    return this->weights[nodeId] > 0 ? this->gains[nodeId] / this->weights[nodeId] : FLT_MAX;
+}
+
+// Atualiza a chave de um nó que está em um dos heaps da reconstrução; sem ganho, ele sai do heap
+void IteratedGreedy::updateCandidate(int nodeId)
+{
+    IndexedHeap *heap = this->candidateHeap->contains(nodeId) ? this->candidateHeap : this->tabuHeap;
+    if (!heap->contains(nodeId))
+        return;
+    if (this->gains[nodeId] == 0)
+        heap->remove(nodeId);
+    else
+        heap->updateKey(nodeId, this->score(nodeId));
+}
+
+/****************
+ * Funcao    : void destroy(int numberDestroyed, int tabuTenure, int iteration, RANDOM_STREAM *stream)           *
+ * Descricao : Retira da solução uma região de nós próximos: parte de um nó sorteado e segue, em largura, pelos  *
+ *             nós da solução que cobrem algum nó coberto por um nó já retirado, sorteando um novo ponto de      *
+ *             partida quando a região se esgota. Em grafos esparsos, nós retirados ao acaso ficariam distantes *
+ *             e a reconstrução apenas desfaria cada retirada isoladamente.                                    *
+ * Parametros: numberDestroyed - quantidade de nós retirados                                                     *
+ *             tabuTenure - iterações em que um nó retirado não pode voltar à solução                            *
+ *             iteration - índice da iteração                                                                     *
+ *             stream - fluxo de números aleatórios da thread                                                    *
+ * Retorno   : Sem retorno.                                                                                      *
+ ***************/
+void IteratedGreedy::destroy(int numberDestroyed, int tabuTenure, int iteration, RANDOM_STREAM *stream)
+{
+    int *offsets = this->forwardGraph->getOffsets();
+    int *targets = this->forwardGraph->getTargets();
+    int *reverseOffsets = this->reverseGraph->getOffsets();
+    int *reverseTargets = this->reverseGraph->getTargets();
+
+    // A fila da busca em largura usa o vetor de candidatos; todo nó marcado está na fila
+    int head = 0, tail = 0;
+    this->currentMark++;
+    numberDestroyed = min(numberDestroyed, this->solutionSize);
+    for (int i = 0; i < numberDestroyed; i++)
+    {
+        if (head == tail)
+        {
+            int startId = this->solution[xrandom_stream(stream, this->solutionSize)];
+            this->marks[startId] = this->currentMark;
+            this->candidates[tail++] = startId;
+        }
+        int nodeId = this->candidates[head++];
+        for (int e = offsets[nodeId] - 1; e < offsets[nodeId + 1]; e++)
+        {
+            int coveredId = e < offsets[nodeId] ? nodeId : targets[e];
+            for (int r = reverseOffsets[coveredId] - 1; r < reverseOffsets[coveredId + 1]; r++)
+            {
+                int neighborId = r < reverseOffsets[coveredId] ? coveredId : reverseTargets[r];
+                if (this->positions[neighborId] != -1 && this->marks[neighborId] != this->currentMark)
+                {
+                    this->marks[neighborId] = this->currentMark;
+                    this->candidates[tail++] = neighborId;
+                }
+            }
+        }
+        this->removeNode(nodeId);
+        this->tabuUntil[nodeId] = iteration + tabuTenure;
+    }
+}
+
+/****************
+ * Funcao    : void repair(int iteration)                                                             *
+ * Descricao : Cobre os nós descobertos inserindo, a cada passo, o nó de maior GANHO/PESO entre os que   *
+ *             cobrem algum nó descoberto (empate pelo maior id). Os candidatos ficam em dois heaps,     *
+ *             atualizados pela inserção, e os tabu só são usados quando nenhum outro candidato existe.  *
+ * Parametros: iteration - índice da iteração, para a lista tabu                                        *
+ * Retorno   : Sem retorno.                                                                            *
+ ***************/
+void IteratedGreedy::repair(int iteration)
+{
+    int *reverseOffsets = this->reverseGraph->getOffsets();
+    int *reverseTargets = this->reverseGraph->getTargets();
+
+    // Só os nós que cobrem algum nó descoberto têm ganho; a inserção não cria candidatos novos
+    this->currentMark++;
+    for (int i = 0; i < this->numberUncovered; i++)
+    {
+        int uncoveredId = this->uncoveredNodes[i];
+        for (int r = reverseOffsets[uncoveredId] - 1; r < reverseOffsets[uncoveredId + 1]; r++)
+        {
+            int candidateId = r < reverseOffsets[uncoveredId] ? uncoveredId : reverseTargets[r];
+            if (this->marks[candidateId] == this->currentMark)
+                continue;
+            this->marks[candidateId] = this->currentMark;
+            IndexedHeap *heap = this->tabuUntil[candidateId] > iteration ? this->tabuHeap : this->candidateHeap;
+            heap->push(candidateId, this->score(candidateId));
+        }
+    }
+
+    // Ao fim, todos os ganhos são nulos e os dois heaps estão vazios
+    this->numberInserted = 0;
+    while (this->numberUncovered > 0)
+    {
+        int insertedId = !this->candidateHeap->isEmpty() ? this->candidateHeap->peek() : this->tabuHeap->peek();
+        this->insertNode(insertedId);
+        this->insertedNodes[this->numberInserted++] = insertedId;
+    }
+}
+
+/****************
+ * Funcao    : void removeRedundantNodes()                                                             *
+ * Descricao : Remove, dos mais pesados para os mais leves, os nós redundantes da solução. Só os nós que  *
+ *             cobrem algum vizinho de um nó inserido nesta iteração podem ter se tornado redundantes.   *
+ * Parametros: Sem parâmetros.                                                                          *
+ * Retorno   : Sem retorno.                                                                            *
+ ***************/
+void IteratedGreedy::removeRedundantNodes()
+{
+    int *offsets = this->forwardGraph->getOffsets();
+    int *targets = this->forwardGraph->getTargets();
+    int *reverseOffsets = this->reverseGraph->getOffsets();
+    int *reverseTargets = this->reverseGraph->getTargets();
+
+    int numCandidates = 0;
+    this->currentMark++;
+    for (int i = 0; i < this->numberInserted; i++)
+    {
+        int insertedId = this->insertedNodes[i];
+        if (this->positions[insertedId] == -1)
+            continue;
+        for (int e = offsets[insertedId] - 1; e < offsets[insertedId + 1]; e++)
+        {
+            int coveredId = e < offsets[insertedId] ? insertedId : targets[e];
+            for (int r = reverseOffsets[coveredId] - 1; r < reverseOffsets[coveredId + 1]; r++)
+            {
+                int coveringId = r < reverseOffsets[coveredId] ? coveredId : reverseTargets[r];
+                if (this->positions[coveringId] == -1 || this->marks[coveringId] == this->currentMark)
+                    continue;
+                this->marks[coveringId] = this->currentMark;
+                this->candidates[numCandidates++] = coveringId;
+            }
+        }
+    }
+    const float *weights = this->weights;
+    sort(this->candidates, this->candidates + numCandidates, [weights](int first, int second)
+         { return weights[first] != weights[second] ? weights[first] > weights[second] : first < second; });
+
+    for (int i = 0; i < numCandidates; i++)
+    {
+        int nodeId = this->candidates[i];
+        bool redundant = true;
+        for (int e = offsets[nodeId] - 1; e < offsets[nodeId + 1] && redundant; e++)
+            redundant = this->coverCounts[e < offsets[nodeId] ? nodeId : targets[e]] >= 2;
+        if (!redundant)
+            continue;
+        this->removeNode(nodeId);
+    }
+}
+
+// Guarda a solução corrente como a melhor encontrada
+void IteratedGreedy::saveBest()
+{
+    for (int i = 0; i < this->solutionSize; i++)
+        this->bestSolution[i] = this->solution[i];
+    this->bestSolutionSize = this->solutionSize;
+    this->bestCost = (float)this->cost;
+}
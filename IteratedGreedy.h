@@ -0,0 +1,90 @@
+/**************************************************************************************************
+ * Implementation of the TAD IteratedGreedy
+ **************************************************************************************************/
+
+#ifndef ITERATEDGREEDY_H_INCLUDED
+#define ITERATEDGREEDY_H_INCLUDED
+#include "CompactGraph.h"
+#include "IndexedHeap.h"
+#include "LocalSearch.h"
+#include "random/random.h"
+
+using namespace std;
+
+// Guloso iterado com lista tabu para o conjunto dominante ponderado: cada iteração retira uma região
+// da solução corrente, reconstrói a cobertura gulosamente sem os nós retirados (que ficam tabu), remove
+// os redundantes e aplica a busca local; soluções piores são aceitas com probabilidade decrescente com a
+// piora. Os contadores de cobertura e os ganhos são mantidos a cada movimento, que custa O(grau) sobre a
+// vizinhança afetada, e valem de uma iteração para a outra: a busca local trabalha sobre eles a partir dos
+// nós que mudaram, e uma solução rejeitada é desfeita pelo registro dos nós alterados na iteração. Assim,
+// uma iteração custa em função da região destruída, e não do tamanho do grafo. Cada thread usa a sua
+// própria instância.
+class IteratedGreedy
+{
+    // Atributos
+private:
+    int size;
+    CompactGraph *forwardGraph;
+    CompactGraph *reverseGraph;
+    const float *weights;
+    int *coverCounts;
+    int *gains;
+    int *positions;
+    int *solution;
+    int solutionSize;
+    double cost;
+    double temperature;
+    int *uncoveredNodes;
+    int *uncoveredPositions;
+    int numberUncovered;
+    int *tabuUntil;
+    int *insertedNodes;
+    int numberInserted;
+    int *touchedNodes;
+    bool *touchedFromSolution;
+    int numberTouched;
+    int *touchMarks;
+    int currentTouch;
+    IndexedHeap *candidateHeap;
+    IndexedHeap *tabuHeap;
+    int *marks;
+    int currentMark;
+    int *candidates;
+    int *bestSolution;
+    int bestSolutionSize;
+    float bestCost;
+    LocalSearch *localSearch;
+
+public:
+    // Construtor
+    IteratedGreedy(CompactGraph *forwardGraph, CompactGraph *reverseGraph, const float *weights);
+
+    // Destrutor
+    ~IteratedGreedy();
+
+    // Getters
+    int getSize();
+    int *getBestSolution();
+    int getBestSolutionSize();
+    float getBestCost();
+
+    // Métodos de manipulação
+    void start(const int *initialSolution, int initialSize);
+    bool iterate(int numberDestroyed, int tabuTenure, int iteration, RANDOM_STREAM *stream);
+
+private:
+    // Métodos auxiliares
+    void loadSolution();
+    void insertNode(int nodeId);
+    void removeNode(int nodeId);
+    void recordTouch(int nodeId, bool fromSolution);
+    void undoIteration();
+    float score(int nodeId);
+    void updateCandidate(int nodeId);
+    void destroy(int numberDestroyed, int tabuTenure, int iteration, RANDOM_STREAM *stream);
+    void repair(int iteration);
+    void removeRedundantNodes();
+    void saveBest();
+};
+
+#endif // ITERATEDGREEDY_H_INCLUDED
@@ -0,0 +1,449 @@
+#include "LocalSearch.h"
+#include <algorithm>
+
+using namespace std;
+
+/**************************************************************************************************
+ * Defining the LocalSearch's methods
+ **************************************************************************************************/
+
+/****************
+ * Funcao    : LocalSearch(CompactGraph *forwardGraph, CompactGraph *reverseGraph, const float *weights, int *coverCounts, int *positions)*
+ * Descricao : Prepara a área de trabalho da busca local sobre adjacências e pesos compartilhados. Com contadores   *
+ *             externos, a busca trabalha sobre eles, que devem descrever a solução passada a improveRegion.       *
+ * Parametros: forwardGraph - adjacências de saída (nós cobertos por cada nó)                                      *
+ *             reverseGraph - adjacências de entrada (nós que cobrem cada nó); em grafos não direcionados          *
+ *                            pode ser o próprio forwardGraph                                                      *
+ *             weights - peso de cada nó, indexado pelo id                                                         *
+ *             coverCounts - quantos nós da solução cobrem cada nó; nullptr aloca contadores próprios               *
+ *             positions - posição de cada nó na solução (-1 fora dela); nullptr aloca posições próprias           *
+ ***************/
+LocalSearch::LocalSearch(CompactGraph *forwardGraph, CompactGraph *reverseGraph, const float *weights) : LocalSearch(forwardGraph, reverseGraph, weights, nullptr, nullptr)
+{
+}
+LocalSearch::LocalSearch(CompactGraph *forwardGraph, CompactGraph *reverseGraph, const float *weights, int *coverCounts, int *positions)
+{
+    this->size = forwardGraph->getSize();
+    this->forwardGraph = forwardGraph;
+    this->reverseGraph = reverseGraph;
+    this->weights = weights;
+    this->ownsCounters = coverCounts == nullptr;
+    this->coverCounts = this->ownsCounters ? new int[this->size] : coverCounts;
+    this->positions = this->ownsCounters ? new int[this->size] : positions;
+    this->marks = new int[this->size];
+    this->candidates = new int[this->size + 1];
+    this->worklist = new int[this->size];
+    this->queued = new bool[this->size];
+    this->changedNodes = new int[this->size];
+    this->changedFromSolution = new bool[this->size];
+    this->changeMarks = new int[this->size];
+    this->currentMark = this->currentChange = 0;
+    this->worklistHead = this->worklistSize = this->numberChanged = 0;
+    for (int i = 0; i < this->size; i++)
+    {
+        if (this->ownsCounters)
+        {
+            this->coverCounts[i] = 0;
+            this->positions[i] = -1;
+        }
+        this->marks[i] = 0;
+        this->queued[i] = false;
+        this->changeMarks[i] = 0;
+    }
+}
+
+// Destrutor
+LocalSearch::~LocalSearch()
+{
+    if (this->ownsCounters)
+    {
+        delete[] this->coverCounts;
+        delete[] this->positions;
+    }
+    delete[] this->marks;
+    delete[] this->candidates;
+    delete[] this->worklist;
+    delete[] this->queued;
+    delete[] this->changedNodes;
+    delete[] this->changedFromSolution;
+    delete[] this->changeMarks;
+    this->coverCounts = this->positions = this->marks = this->candidates = this->worklist = nullptr;
+    this->changedNodes = this->changeMarks = nullptr;
+    this->queued = this->changedFromSolution = nullptr;
+    this->forwardGraph = this->reverseGraph = nullptr;
+    this->weights = nullptr;
+    this->size = 0;
+}
+
+// Getters
+int LocalSearch::getSize()
+{
+    return this->size;
+}
+int *LocalSearch::getChangedNodes()
+{
+    return this->changedNodes;
+}
+bool *LocalSearch::getChangedFromSolution()
+{
+    return this->changedFromSolution;
+}
+int LocalSearch::getNumberChanged()
+{
+    return this->numberChanged;
+}
+
+// Métodos de manipulação
+//
+
+/****************
+ * Funcao    : float improve(int *solution, int *solutionSize)                                             *
+ * Descricao : Melhora uma solução dominante até um ótimo local: remove os nós redundantes (todo nó da     *
+ *             sua vizinhança fechada coberto por outro) e aplica trocas em que um nó de fora entra e um   *
+ *             ou dois nós da solução, que se tornam redundantes, saem com peso total maior. A primeira   *
+ *             passada tenta todos os nós; depois, a fila guarda só os nós de fora da solução que cobrem  *
+ *             algum nó cujo contador mudou, e a busca termina quando ela se esvazia.                     *
+ * Parametros: solution - ids dos nós da solução, com espaço para todos os nós do grafo                    *
+ *             solutionSize - endereço da quantidade de nós da solução                                    *
+ * Retorno   : Retorna o custo da solução melhorada.                                                       *
+ ***************/
+float LocalSearch::improve(int *solution, int *solutionSize)
+{
+    int *offsets = this->forwardGraph->getOffsets();
+    int *targets = this->forwardGraph->getTargets();
+
+    // Contadores de cobertura da solução inicial
+    for (int i = 0; i < *solutionSize; i++)
+    {
+        int nodeId = solution[i];
+        this->positions[nodeId] = i;
+        this->coverCounts[nodeId]++;
+        for (int e = offsets[nodeId]; e < offsets[nodeId + 1]; e++)
+            this->coverCounts[targets[e]]++;
+    }
+
+    this->currentChange++;
+    this->numberChanged = 0;
+    this->removeRedundantNodes(solution, solutionSize);
+    for (int nodeId = 0; nodeId < this->size; nodeId++)
+        this->queueNode(nodeId);
+    this->processWorklist(solution, solutionSize);
+
+    // Custo final e limpeza dos contadores para a próxima solução
+    float totalCost = 0;
+    for (int i = 0; i < *solutionSize; i++)
+    {
+        int nodeId = solution[i];
+        totalCost += this->weights[nodeId];
+        this->positions[nodeId] = -1;
+        this->coverCounts[nodeId] = 0;
+        for (int e = offsets[nodeId]; e < offsets[nodeId + 1]; e++)
+            this->coverCounts[targets[e]] = 0;
+    }
+    return totalCost;
+}
+
+/****************
+ * Funcao    : float improveRegion(int *solution, int *solutionSize, const int *seeds, int numberSeeds)            *
+ * Descricao : Continua a busca a partir de um ótimo local alterado fora dela, com os contadores externos já    *
+ *             descrevendo a solução alterada, que deve ser dominante. Cada nó que entrou ou saiu é tratado     *
+ *             como uma troca da própria busca: os nós de fora ao redor dele vão para a fila. Os contadores     *
+ *             continuam valendo ao fim, e os nós que mudaram ficam em getChangedNodes, com a pertinência à     *
+ *             solução antes da primeira mudança em getChangedFromSolution.                                    *
+ * Parametros: solution - ids dos nós da solução                                                                  *
+ *             solutionSize - endereço da quantidade de nós da solução                                           *
+ *             seeds - nós que entraram ou saíram da solução desde o último ótimo local                          *
+ *             numberSeeds - quantidade de nós em seeds                                                          *
+ * Retorno   : Retorna a variação do custo da solução (negativa ou nula).                                        *
+ ***************/
+float LocalSearch::improveRegion(int *solution, int *solutionSize, const int *seeds, int numberSeeds)
+{
+    this->currentChange++;
+    this->numberChanged = 0;
+    // Uma só marcação para todas as sementes: cada nó da solução da região é expandido uma vez. A fila
+    // segue a ordem dos ids, como na passada completa, para que a busca não comece sempre desfazendo a
+    // última alteração. Se a região já alcança boa parte dos nós de fora, a passada completa é mais barata
+    this->currentMark++;
+    this->worklistHead = 0;
+    bool fullPass = false;
+    for (int i = 0; i < numberSeeds && !fullPass; i++)
+    {
+        this->queueAround(seeds[i]);
+        fullPass = 2 * this->worklistSize > this->size - *solutionSize;
+    }
+    if (fullPass)
+    {
+        for (int i = 0; i < this->worklistSize; i++)
+            this->queued[this->worklist[i]] = false;
+        this->worklistSize = 0;
+        for (int nodeId = 0; nodeId < this->size; nodeId++)
+            this->queueNode(nodeId);
+    }
+    else
+        sort(this->worklist, this->worklist + this->worklistSize);
+    this->processWorklist(solution, solutionSize);
+
+    float costChange = 0;
+    for (int i = 0; i < this->numberChanged; i++)
+    {
+        int nodeId = this->changedNodes[i];
+        bool inSolution = this->positions[nodeId] != -1;
+        if (inSolution != this->changedFromSolution[i])
+            costChange += inSolution ? this->weights[nodeId] : -this->weights[nodeId];
+    }
+    return costChange;
+}
+
+// Métodos auxiliares
+//
+
+// Tenta uma troca para cada nó da fila até esvaziá-la; trocas mantidas colocam novos nós na fila
+void LocalSearch::processWorklist(int *solution, int *solutionSize)
+{
+    while (this->worklistSize > 0)
+    {
+        int nodeId = this->worklist[this->worklistHead];
+        this->worklistHead = (this->worklistHead + 1) % this->size;
+        this->worklistSize--;
+        this->queued[nodeId] = false;
+        this->trySwap(solution, solutionSize, nodeId);
+    }
+}
+
+// Registra a primeira mudança de um nó na chamada, com a sua pertinência à solução antes dela
+void LocalSearch::recordChange(int nodeId)
+{
+    if (this->changeMarks[nodeId] == this->currentChange)
+        return;
+    this->changeMarks[nodeId] = this->currentChange;
+    this->changedFromSolution[this->numberChanged] = this->positions[nodeId] != -1;
+    this->changedNodes[this->numberChanged++] = nodeId;
+}
+
+void LocalSearch::insertNode(int *solution, int *solutionSize, int nodeId)
+{
+    this->recordChange(nodeId);
+    int *offsets = this->forwardGraph->getOffsets();
+    int *targets = this->forwardGraph->getTargets();
+    solution[*solutionSize] = nodeId;
+    this->positions[nodeId] = (*solutionSize)++;
+    this->coverCounts[nodeId]++;
+    for (int e = offsets[nodeId]; e < offsets[nodeId + 1]; e++)
+        this->coverCounts[targets[e]]++;
+}
+
+void LocalSearch::removeNode(int *solution, int *solutionSize, int nodeId)
+{
+    this->recordChange(nodeId);
+    int *offsets = this->forwardGraph->getOffsets();
+    int *targets = this->forwardGraph->getTargets();
+    int position = this->positions[nodeId];
+    int lastId = solution[--(*solutionSize)];
+    solution[position] = lastId;
+    this->positions[lastId] = position;
+    this->positions[nodeId] = -1;
+    this->coverCounts[nodeId]--;
+    for (int e = offsets[nodeId]; e < offsets[nodeId + 1]; e++)
+        this->coverCounts[targets[e]]--;
+}
+
+/****************
+ * Funcao    : bool isRedundant(int nodeId)                                                 *
+ * Descricao : Verifica, em O(grau), se um nó da solução pode sair sem descobrir nenhum nó   *
+ * Parametros: nodeId - id do nó da solução                                                 *
+ * Retorno   : Retorna true se toda a vizinhança fechada do nó é coberta por outro nó.       *
+ ***************/
+bool LocalSearch::isRedundant(int nodeId)
+{
+    int *offsets = this->forwardGraph->getOffsets();
+    int *targets = this->forwardGraph->getTargets();
+    if (this->coverCounts[nodeId] < 2)
+        return false;
+    for (int e = offsets[nodeId]; e < offsets[nodeId + 1]; e++)
+        if (this->coverCounts[targets[e]] < 2)
+            return false;
+    return true;
+}
+
+/****************
+ * Funcao    : bool removeRedundantNodes(int *solution, int *solutionSize)                  *
+ * Descricao : Remove os nós redundantes da solução, dos mais pesados para os mais leves     *
+ * Parametros: solution - ids dos nós da solução                                            *
+ *             solutionSize - endereço da quantidade de nós da solução                      *
+ * Retorno   : Retorna true se algum nó foi removido.                                       *
+ ***************/
+bool LocalSearch::removeRedundantNodes(int *solution, int *solutionSize)
+{
+    int numCandidates = *solutionSize;
+    for (int i = 0; i < numCandidates; i++)
+        this->candidates[i] = solution[i];
+    this->sortByWeight(this->candidates, numCandidates);
+
+    bool removed = false;
+    for (int i = 0; i < numCandidates; i++)
+        if (this->isRedundant(this->candidates[i]))
+        {
+            this->removeNode(solution, solutionSize, this->candidates[i]);
+            removed = true;
+        }
+    return removed;
+}
+
+/****************
+ * Funcao    : bool trySwap(int *solution, int *solutionSize, int nodeId)                                  *
+ * Descricao : Tenta inserir um nó de fora da solução e retirar até dois nós que se tornem redundantes     *
+ *             (trocas 1-1 e 2-1). Só os nós da solução que cobrem algum vizinho do nó inserido podem se   *
+ *             tornar redundantes, e a cada retirada sai o mais pesado deles que está redundante. Mantida  *
+ *             a troca, os demais redundantes saem também e os nós de fora ao redor voltam para a fila.    *
+ * Parametros: solution - ids dos nós da solução                                                          *
+ *             solutionSize - endereço da quantidade de nós da solução                                    *
+ *             nodeId - id do nó a inserir                                                                *
+ * Retorno   : Retorna true se a troca reduziu o custo e foi mantida.                                     *
+ ***************/
+bool LocalSearch::trySwap(int *solution, int *solutionSize, int nodeId)
+{
+    if (this->positions[nodeId] != -1)
+        return false;
+    int *offsets = this->forwardGraph->getOffsets();
+    int *targets = this->forwardGraph->getTargets();
+    int *reverseOffsets = this->reverseGraph->getOffsets();
+    int *reverseTargets = this->reverseGraph->getTargets();
+
+    // Nós da solução que cobrem a vizinhança fechada do nó inserido
+    this->currentMark++;
+    int numCandidates = 0;
+    float heaviest = 0, secondHeaviest = 0;
+    for (int e = offsets[nodeId] - 1; e < offsets[nodeId + 1]; e++)
+    {
+        int coveredId = e < offsets[nodeId] ? nodeId : targets[e];
+        for (int r = reverseOffsets[coveredId] - 1; r < reverseOffsets[coveredId + 1]; r++)
+        {
+            int coveringId = r < reverseOffsets[coveredId] ? coveredId : reverseTargets[r];
+            if (this->positions[coveringId] == -1 || this->marks[coveringId] == this->currentMark)
+                continue;
+            this->marks[coveringId] = this->currentMark;
+            this->candidates[numCandidates++] = coveringId;
+            float weight = this->weights[coveringId];
+            if (weight > heaviest)
+            {
+                secondHeaviest = heaviest;
+                heaviest = weight;
+            }
+            else if (weight > secondHeaviest)
+                secondHeaviest = weight;
+        }
+    }
+    if (heaviest + secondHeaviest <= this->weights[nodeId])
+        return false;
+
+    this->insertNode(solution, solutionSize, nodeId);
+    int removedIds[2];
+    int numRemoved = 0;
+    float removedWeight = 0;
+    for (int removedId; numRemoved < 2 && (removedId = this->heaviestRedundant(numCandidates)) != -1;)
+    {
+        this->removeNode(solution, solutionSize, removedId);
+        removedIds[numRemoved++] = removedId;
+        removedWeight += this->weights[removedId];
+    }
+    if (removedWeight > this->weights[nodeId])
+    {
+        // Só os contadores da vizinhança do nó inserido subiram: o próprio nó e os candidatos são os
+        // únicos que podem ter ficado redundantes
+        this->queueCoverers(nodeId);
+        for (int i = 0; i < numRemoved; i++)
+            this->queueCoverers(removedIds[i]);
+        this->candidates[numCandidates++] = nodeId;
+        for (int removedId; (removedId = this->heaviestRedundant(numCandidates)) != -1;)
+        {
+            this->removeNode(solution, solutionSize, removedId);
+            this->queueCoverers(removedId);
+        }
+        return true;
+    }
+
+    // Desfaz a troca
+    for (int i = 0; i < numRemoved; i++)
+        this->insertNode(solution, solutionSize, removedIds[i]);
+    this->removeNode(solution, solutionSize, nodeId);
+    return false;
+}
+
+// Candidato ainda na solução que está redundante e é o mais pesado (empate pelo menor id), ou -1
+int LocalSearch::heaviestRedundant(int numCandidates)
+{
+    int heaviestId = -1;
+    for (int i = 0; i < numCandidates; i++)
+    {
+        int candidateId = this->candidates[i];
+        if (this->positions[candidateId] == -1)
+            continue;
+        if (heaviestId != -1 && (this->weights[candidateId] < this->weights[heaviestId] ||
+                                 (this->weights[candidateId] == this->weights[heaviestId] && candidateId > heaviestId)))
+            continue;
+        if (this->isRedundant(candidateId))
+            heaviestId = candidateId;
+    }
+    return heaviestId;
+}
+
+// Coloca um nó no fim da fila de trabalho, se ele ainda não está nela
+void LocalSearch::queueNode(int nodeId)
+{
+    if (this->queued[nodeId])
+        return;
+    this->queued[nodeId] = true;
+    this->worklist[(this->worklistHead + this->worklistSize++) % this->size] = nodeId;
+}
+
+// Coloca na fila os nós que uma entrada ou saída pode ter tornado aptos a uma troca: os contadores da
+// vizinhança fechada do nó mudaram, o que afeta os nós de fora que cobrem essa vizinhança e, pela
+// redundância dos nós da solução que também a cobrem, os nós de fora que cobrem a vizinhança destes
+void LocalSearch::queueCoverers(int nodeId)
+{
+    this->currentMark++;
+    this->queueAround(nodeId);
+}
+
+// Corpo de queueCoverers, sem renovar a marcação dos nós da solução já expandidos
+void LocalSearch::queueAround(int nodeId)
+{
+    int *offsets = this->forwardGraph->getOffsets();
+    int *targets = this->forwardGraph->getTargets();
+    int *reverseOffsets = this->reverseGraph->getOffsets();
+    int *reverseTargets = this->reverseGraph->getTargets();
+    for (int e = offsets[nodeId] - 1; e < offsets[nodeId + 1]; e++)
+    {
+        int coveredId = e < offsets[nodeId] ? nodeId : targets[e];
+        for (int r = reverseOffsets[coveredId] - 1; r < reverseOffsets[coveredId + 1]; r++)
+        {
+            int coveringId = r < reverseOffsets[coveredId] ? coveredId : reverseTargets[r];
+            if (this->positions[coveringId] == -1)
+            {
+                this->queueNode(coveringId);
+                continue;
+            }
+            if (this->marks[coveringId] == this->currentMark)
+                continue;
+            this->marks[coveringId] = this->currentMark;
+            for (int f = offsets[coveringId] - 1; f < offsets[coveringId + 1]; f++)
+            {
+                int secondId = f < offsets[coveringId] ? coveringId : targets[f];
+                for (int q = reverseOffsets[secondId] - 1; q < reverseOffsets[secondId + 1]; q++)
+                {
+                    int swapId = q < reverseOffsets[secondId] ? secondId : reverseTargets[q];
+                    if (this->positions[swapId] == -1)
+                        this->queueNode(swapId);
+                }
+            }
+        }
+    }
+}
+
+// Ordena nós pelo peso decrescente, desempatando pelo id
+void LocalSearch::sortByWeight(int *nodes, int numNodes)
+{
+    const float *weights = this->weights;
+    sort(nodes, nodes + numNodes, [weights](int first, int second)
+         { return weights[first] != weights[second] ? weights[first] > weights[second] : first < second; });
+}
@@ -0,0 +1,74 @@
+/**************************************************************************************************
+ * Implementation of the TAD LocalSearch
+ **************************************************************************************************/
+
+#ifndef LOCALSEARCH_H_INCLUDED
+#define LOCALSEARCH_H_INCLUDED
+#include "CompactGraph.h"
+
+using namespace std;
+
+// Busca local para soluções do conjunto dominante ponderado: remoção de nós redundantes e trocas 1-1 e
+// 2-1, avaliadas com contadores de cobertura por nó. Depois da primeira passada, só são tentados de novo
+// os nós cuja vizinhança teve contadores alterados por uma troca (fila de trabalho). As adjacências e os
+// pesos são compartilhados; cada thread usa a sua própria instância. Construída sobre os contadores de
+// quem a chama, a busca os mantém entre as chamadas e pode recomeçar só ao redor dos nós que mudaram.
+class LocalSearch
+{
+    // Atributos
+private:
+    int size;
+    CompactGraph *forwardGraph;
+    CompactGraph *reverseGraph;
+    const float *weights;
+    bool ownsCounters;
+    int *coverCounts;
+    int *positions;
+    int *marks;
+    int currentMark;
+    int *candidates;
+    int *worklist;
+    bool *queued;
+    int worklistHead;
+    int worklistSize;
+    int *changedNodes;
+    bool *changedFromSolution;
+    int numberChanged;
+    int *changeMarks;
+    int currentChange;
+
+public:
+    // Construtor
+    LocalSearch(CompactGraph *forwardGraph, CompactGraph *reverseGraph, const float *weights);
+    LocalSearch(CompactGraph *forwardGraph, CompactGraph *reverseGraph, const float *weights, int *coverCounts, int *positions);
+
+    // Destrutor
+    ~LocalSearch();
+
+    // Getters
+    int getSize();
+    int *getChangedNodes();
+    bool *getChangedFromSolution();
+    int getNumberChanged();
+
+    // Métodos de manipulação
+    float improve(int *solution, int *solutionSize);
+    float improveRegion(int *solution, int *solutionSize, const int *seeds, int numberSeeds);
+
+private:
+    // Métodos auxiliares
+    void processWorklist(int *solution, int *solutionSize);
+    void recordChange(int nodeId);
+    void insertNode(int *solution, int *solutionSize, int nodeId);
+    void removeNode(int *solution, int *solutionSize, int nodeId);
+    bool isRedundant(int nodeId);
+    bool removeRedundantNodes(int *solution, int *solutionSize);
+    bool trySwap(int *solution, int *solutionSize, int nodeId);
+    int heaviestRedundant(int numCandidates);
+    void queueNode(int nodeId);
+    void queueCoverers(int nodeId);
+    void queueAround(int nodeId);
+    void sortByWeight(int *nodes, int numNodes);
+};
+
+#endif // LOCALSEARCH_H_INCLUDED
@@ -0,0 +1,200 @@
+#include "PathRelinking.h"
+#include <cfloat>
+
+using namespace std;
+
+/**************************************************************************************************
+ * Defining the PathRelinking's methods
+ **************************************************************************************************/
+
+/****************
+ * Funcao    : PathRelinking(CompactGraph *forwardGraph, const float *weights)            *
+ * Descricao : Aloca os contadores de cobertura e as listas de movimentos do religamento *
+ * Parametros: forwardGraph - adjacências de saída (nós cobertos por cada nó)            *
+ *             weights - peso de cada nó, indexado pelo id                               *
+ ***************/
+PathRelinking::PathRelinking(CompactGraph *forwardGraph, const float *weights)
+{
+    this->size = forwardGraph->getSize();
+    this->forwardGraph = forwardGraph;
+    this->weights = weights;
+    this->coverCounts = new int[this->size];
+    this->positions = new int[this->size];
+    this->solution = new int[this->size];
+    this->marks = new int[this->size];
+    this->insertCandidates = new int[this->size];
+    this->removeCandidates = new int[this->size];
+    this->solutionSize = 0;
+    this->cost = 0;
+    this->currentMark = 0;
+    for (int i = 0; i < this->size; i++)
+    {
+        this->coverCounts[i] = 0;
+        this->positions[i] = -1;
+        this->marks[i] = 0;
+    }
+}
+
+// Destrutor
+PathRelinking::~PathRelinking()
+{
+    delete[] this->coverCounts;
+    delete[] this->positions;
+    delete[] this->solution;
+    delete[] this->marks;
+    delete[] this->insertCandidates;
+    delete[] this->removeCandidates;
+    this->coverCounts = this->positions = this->solution = this->marks = nullptr;
+    this->insertCandidates = this->removeCandidates = nullptr;
+    this->forwardGraph = nullptr;
+    this->weights = nullptr;
+    this->size = 0;
+}
+
+// Getters
+int PathRelinking::getSize()
+{
+    return this->size;
+}
+
+// Métodos de manipulação
+//
+
+/****************
+ * Funcao    : float relink(const int *sourceSolution, int sourceSize, const int *guideSolution, int guideSize, int *bestSolution, int *bestSolutionSize)*
+ * Descricao : Caminha da solução de origem até a guia. A cada passo, retira o nó mais pesado que só está na    *
+ *             origem e se tornou redundante; se nenhum puder sair, insere o nó que só está na guia e cobre     *
+ *             mais nós cobertos uma única vez, por unidade de peso (empate pelo menor id), o que prepara as    *
+ *             próximas retiradas. Todas as soluções do caminho são dominantes, e a mais barata entre as        *
+ *             intermediárias (sem contar a origem e a guia) é devolvida.                                      *
+ * Parametros: sourceSolution - ids dos nós da solução de origem                                                 *
+ *             sourceSize - quantidade de nós da solução de origem                                               *
+ *             guideSolution - ids dos nós da solução guia                                                       *
+ *             guideSize - quantidade de nós da solução guia                                                     *
+ *             bestSolution - vetor, com espaço para todos os nós, que recebe a melhor solução intermediária     *
+ *             bestSolutionSize - endereço da quantidade de nós da melhor solução intermediária                  *
+ * Retorno   : Retorna o custo da melhor solução intermediária, ou FLT_MAX se o caminho não tem intermediárias. *
+ ***************/
+float PathRelinking::relink(const int *sourceSolution, int sourceSize, const int *guideSolution, int guideSize, int *bestSolution, int *bestSolutionSize)
+{
+    // Carrega a origem nos contadores e separa os nós de cada lado da diferença simétrica
+    while (this->solutionSize > 0)
+        this->removeNode(this->solution[this->solutionSize - 1]);
+    this->cost = 0;
+    for (int i = 0; i < sourceSize; i++)
+        this->insertNode(sourceSolution[i]);
+    this->currentMark++;
+    int numberInsert = 0, numberRemove = 0;
+    for (int i = 0; i < guideSize; i++)
+    {
+        this->marks[guideSolution[i]] = this->currentMark;
+        if (this->positions[guideSolution[i]] == -1)
+            this->insertCandidates[numberInsert++] = guideSolution[i];
+    }
+    for (int i = 0; i < sourceSize; i++)
+        if (this->marks[sourceSolution[i]] != this->currentMark)
+            this->removeCandidates[numberRemove++] = sourceSolution[i];
+
+    float bestCost = FLT_MAX;
+    while (numberInsert + numberRemove > 0)
+    {
+        // Retirada do nó redundante mais pesado
+        int removeIndex = -1;
+        for (int i = 0; i < numberRemove; i++)
+        {
+            int nodeId = this->removeCandidates[i];
+            if (removeIndex != -1 && (this->weights[nodeId] < this->weights[this->removeCandidates[removeIndex]] ||
+                                      (this->weights[nodeId] == this->weights[this->removeCandidates[removeIndex]] && nodeId > this->removeCandidates[removeIndex])))
+                continue;
+            if (this->isRedundant(nodeId))
+                removeIndex = i;
+        }
+        if (removeIndex != -1)
+        {
+            this->removeNode(this->removeCandidates[removeIndex]);
+            this->removeCandidates[removeIndex] = this->removeCandidates[--numberRemove];
+        }
+        else
+        {
+            // Sem retiradas possíveis, há nós da guia por inserir: com todos inseridos, a guia cobre o grafo
+            int insertIndex = 0;
+            float bestScore = -1;
+            for (int i = 0; i < numberInsert; i++)
+            {
+                int nodeId = this->insertCandidates[i];
+                int coverage = this->criticalCoverage(nodeId);
+                float score = this->weights[nodeId] > 0 ? coverage / this->weights[nodeId] : FLT_MAX;
+                if (score > bestScore || (score == bestScore && nodeId < this->insertCandidates[insertIndex]))
+                {
+                    bestScore = score;
+                    insertIndex = i;
+                }
+            }
+            this->insertNode(this->insertCandidates[insertIndex]);
+            this->insertCandidates[insertIndex] = this->insertCandidates[--numberInsert];
+        }
+
+        // Guarda a solução intermediária se for a mais barata do caminho
+        if (numberInsert + numberRemove > 0 && this->cost < bestCost)
+        {
+            bestCost = (float)this->cost;
+            for (int i = 0; i < this->solutionSize; i++)
+                bestSolution[i] = this->solution[i];
+            *bestSolutionSize = this->solutionSize;
+        }
+    }
+    return bestCost;
+}
+
+// Métodos auxiliares
+//
+
+// Coloca um nó na solução do caminho, atualizando os contadores da sua vizinhança fechada
+void PathRelinking::insertNode(int nodeId)
+{
+    int *offsets = this->forwardGraph->getOffsets();
+    int *targets = this->forwardGraph->getTargets();
+    this->solution[this->solutionSize] = nodeId;
+    this->positions[nodeId] = this->solutionSize++;
+    this->cost += this->weights[nodeId];
+    for (int e = offsets[nodeId] - 1; e < offsets[nodeId + 1]; e++)
+        this->coverCounts[e < offsets[nodeId] ? nodeId : targets[e]]++;
+}
+
+// Retira um nó da solução do caminho, atualizando os contadores da sua vizinhança fechada
+void PathRelinking::removeNode(int nodeId)
+{
+    int *offsets = this->forwardGraph->getOffsets();
+    int *targets = this->forwardGraph->getTargets();
+    int position = this->positions[nodeId];
+    int lastId = this->solution[--this->solutionSize];
+    this->solution[position] = lastId;
+    this->positions[lastId] = position;
+    this->positions[nodeId] = -1;
+    this->cost -= this->weights[nodeId];
+    for (int e = offsets[nodeId] - 1; e < offsets[nodeId + 1]; e++)
+        this->coverCounts[e < offsets[nodeId] ? nodeId : targets[e]]--;
+}
+
+// Verifica, em O(grau), se um nó da solução pode sair sem descobrir nenhum nó
+bool PathRelinking::isRedundant(int nodeId)
+{
+    int *offsets = this->forwardGraph->getOffsets();
+    int *targets = this->forwardGraph->getTargets();
+    for (int e = offsets[nodeId] - 1; e < offsets[nodeId + 1]; e++)
+        if (this->coverCounts[e < offsets[nodeId] ? nodeId : targets[e]] < 2)
+            return false;
+    return true;
+}
+
+// Quantidade de nós da vizinhança fechada cobertos por um único nó da solução
+int PathRelinking::criticalCoverage(int nodeId)
+{
+    int *offsets = this->forwardGraph->getOffsets();
+    int *targets = this->forwardGraph->getTargets();
+    int coverage = 0;
+    for (int e = offsets[nodeId] - 1; e < offsets[nodeId + 1]; e++)
+        if (this->coverCounts[e < offsets[nodeId] ? nodeId : targets[e]] == 1)
+            coverage++;
+    return coverage;
+}
@@ -0,0 +1,54 @@
+/**************************************************************************************************
+ * Implementation of the TAD PathRelinking
+ **************************************************************************************************/
+
+#ifndef PATHRELINKING_H_INCLUDED
+#define PATHRELINKING_H_INCLUDED
+#include "CompactGraph.h"
+
+using namespace std;
+
+// Religamento de caminhos entre duas soluções do conjunto dominante ponderado: parte da solução de
+// origem e caminha até a solução guia, a cada passo retirando um nó que só está na origem ou
+// inserindo um que só está na guia, sempre por soluções dominantes. Cada passo é avaliado com
+// contadores de cobertura por nó, em O(grau) por nó examinado. As adjacências e os pesos são
+// compartilhados; cada thread usa a sua própria instância.
+class PathRelinking
+{
+    // Atributos
+private:
+    int size;
+    CompactGraph *forwardGraph;
+    const float *weights;
+    int *coverCounts;
+    int *positions;
+    int *solution;
+    int solutionSize;
+    double cost;
+    int *marks;
+    int currentMark;
+    int *insertCandidates;
+    int *removeCandidates;
+
+public:
+    // Construtor
+    PathRelinking(CompactGraph *forwardGraph, const float *weights);
+
+    // Destrutor
+    ~PathRelinking();
+
+    // Getters
+    int getSize();
+
+    // Métodos de manipulação
+    float relink(const int *sourceSolution, int sourceSize, const int *guideSolution, int guideSize, int *bestSolution, int *bestSolutionSize);
+
+private:
+    // Métodos auxiliares
+    void insertNode(int nodeId);
+    void removeNode(int nodeId);
+    bool isRedundant(int nodeId);
+    int criticalCoverage(int nodeId);
+};
+
+#endif // PATHRELINKING_H_INCLUDED
@@ -0,0 +1,326 @@
+#include "PointToPointQuery.h"
+#include "Graph.h"
+#include <cfloat>
+
+using namespace std;
+
+/**************************************************************************************************
+ * Defining the PointToPointQuery's methods
+ **************************************************************************************************/
+
+/****************
+ * Funcao    : PointToPointQuery(Graph *graph, int numLandmarks)                                       *
+ * Descricao : Copia as adjacências (direta e reversa), escolhe os landmarks e pré-calcula as           *
+ *             distâncias de e para cada um deles                                                      *
+ * Parametros: graph - grafo consultado; alterações posteriores no grafo não são refletidas            *
+ *             numLandmarks - quantidade de landmarks usados pelo ALT (0 desativa os limites)           *
+ ***************/
+PointToPointQuery::PointToPointQuery(Graph *graph, int numLandmarks)
+{
+    this->forwardGraph = new CompactGraph(graph, false);
+    this->backwardGraph = graph->getDirected() ? new CompactGraph(graph, true) : this->forwardGraph;
+    this->size = this->forwardGraph->getSize();
+    this->valid = !this->forwardGraph->hasNegativeEdge();
+    if (numLandmarks > this->size)
+        numLandmarks = this->size;
+    if (numLandmarks < 0 || !this->valid)
+        numLandmarks = 0;
+    this->numLandmarks = numLandmarks;
+
+    this->forwardDistances = new float[this->size];
+    this->backwardDistances = new float[this->size];
+    this->potentials = new float[this->size];
+    this->touched = new int[this->size + 1];
+    this->numTouched = 0;
+    for (int i = 0; i < this->size; i++)
+    {
+        this->forwardDistances[i] = FLT_MAX;
+        this->backwardDistances[i] = FLT_MAX;
+        this->potentials[i] = -1;
+    }
+    this->forwardHeap = new IndexedHeap(this->size);
+    this->backwardHeap = new IndexedHeap(this->size);
+    this->settledNodes = 0;
+
+    this->landmarks = new int[numLandmarks > 0 ? numLandmarks : 1];
+    this->fromLandmark = new float[(size_t)numLandmarks * this->size];
+    this->toLandmark = graph->getDirected() ? new float[(size_t)numLandmarks * this->size] : this->fromLandmark;
+    this->selectLandmarks();
+}
+
+// Destrutor
+PointToPointQuery::~PointToPointQuery()
+{
+    if (this->toLandmark != this->fromLandmark)
+        delete[] this->toLandmark;
+    delete[] this->fromLandmark;
+    delete[] this->landmarks;
+    delete[] this->forwardDistances;
+    delete[] this->backwardDistances;
+    delete[] this->potentials;
+    delete[] this->touched;
+    delete this->forwardHeap;
+    delete this->backwardHeap;
+    if (this->backwardGraph != this->forwardGraph)
+        delete this->backwardGraph;
+    delete this->forwardGraph;
+    this->forwardGraph = this->backwardGraph = nullptr;
+    this->size = 0;
+    this->numLandmarks = 0;
+}
+
+// Getters
+int PointToPointQuery::getSize()
+{
+    return this->size;
+}
+int PointToPointQuery::getNumLandmarks()
+{
+    return this->numLandmarks;
+}
+int *PointToPointQuery::getLandmarks()
+{
+    return this->landmarks;
+}
+int PointToPointQuery::getSettledNodes()
+{
+    return this->settledNodes;
+}
+
+// Métodos de consulta
+//
+
+/****************
+ * Funcao    : float bidirectionalDijkstra(int sourceId, int targetId)                                      *
+ * Descricao : Dijkstra simultâneo a partir da origem (grafo direto) e do destino (grafo reverso),          *
+ *             expandindo sempre o lado de menor chave, até que a soma dos topos dos dois heaps alcance o   *
+ *             melhor caminho já encontrado pelo encontro das duas buscas                                  *
+ * Parametros: sourceId - id do nó de origem                                                              *
+ *             targetId - id do nó de destino                                                             *
+ * Retorno   : Retorna o custo do caminho mínimo, ou FLT_MAX se inalcançável.                             *
+ ***************/
+float PointToPointQuery::bidirectionalDijkstra(int sourceId, int targetId)
+{
+    this->resetWorkspace();
+    float bestPath = sourceId == targetId ? 0 : FLT_MAX;
+
+    this->touch(sourceId);
+    this->touch(targetId);
+    this->forwardDistances[sourceId] = 0;
+    this->backwardDistances[targetId] = 0;
+    this->forwardHeap->push(sourceId, 0);
+    this->backwardHeap->push(targetId, 0);
+
+    while (!this->forwardHeap->isEmpty() && !this->backwardHeap->isEmpty())
+    {
+        float forwardTop = this->forwardHeap->getKey(this->forwardHeap->peek());
+        float backwardTop = this->backwardHeap->getKey(this->backwardHeap->peek());
+        if (forwardTop + backwardTop >= bestPath)
+            break;
+
+        // Expande o lado de menor chave
+        bool forward = forwardTop <= backwardTop;
+        CompactGraph *side = forward ? this->forwardGraph : this->backwardGraph;
+        IndexedHeap *heap = forward ? this->forwardHeap : this->backwardHeap;
+        float *distances = forward ? this->forwardDistances : this->backwardDistances;
+        float *otherDistances = forward ? this->backwardDistances : this->forwardDistances;
+        int *offsets = side->getOffsets();
+        int *targets = side->getTargets();
+        float *edgeWeights = side->getEdgeWeights();
+
+        int u = heap->pop();
+        this->settledNodes++;
+        for (int e = offsets[u]; e < offsets[u + 1]; e++)
+        {
+            int v = targets[e];
+            float candidate = distances[u] + edgeWeights[e];
+            if (candidate < distances[v])
+            {
+                if (distances[v] == FLT_MAX && otherDistances[v] == FLT_MAX)
+                    this->touch(v);
+                distances[v] = candidate;
+                if (heap->contains(v))
+                    heap->decreaseKey(v, candidate);
+                else
+                    heap->push(v, candidate);
+            }
+            if (otherDistances[v] != FLT_MAX && distances[v] + otherDistances[v] < bestPath)
+                bestPath = distances[v] + otherDistances[v];
+        }
+    }
+
+    return bestPath;
+}
+
+/****************
+ * Funcao    : float aStarLandmarks(int sourceId, int targetId)                                              *
+ * Descricao : A* da origem ao destino guiado pelo limite inferior dos landmarks (desigualdade triangular),  *
+ *             encerrando assim que o destino é retirado do heap                                            *
+ * Parametros: sourceId - id do nó de origem                                                               *
+ *             targetId - id do nó de destino                                                              *
+ * Retorno   : Retorna o custo do caminho mínimo, ou FLT_MAX se inalcançável.                              *
+ ***************/
+float PointToPointQuery::aStarLandmarks(int sourceId, int targetId)
+{
+    this->resetWorkspace();
+    int *offsets = this->forwardGraph->getOffsets();
+    int *targets = this->forwardGraph->getTargets();
+    float *edgeWeights = this->forwardGraph->getEdgeWeights();
+
+    this->touch(sourceId);
+    this->potentials[sourceId] = this->landmarkLowerBound(sourceId, targetId);
+    if (this->potentials[sourceId] == FLT_MAX)
+        return FLT_MAX;
+    this->forwardDistances[sourceId] = 0;
+    this->forwardHeap->push(sourceId, this->potentials[sourceId]);
+
+    while (!this->forwardHeap->isEmpty())
+    {
+        int u = this->forwardHeap->pop();
+        this->settledNodes++;
+        if (u == targetId)
+            return this->forwardDistances[u];
+
+        for (int e = offsets[u]; e < offsets[u + 1]; e++)
+        {
+            int v = targets[e];
+            if (this->potentials[v] < 0)
+            {
+                this->touch(v);
+                this->potentials[v] = this->landmarkLowerBound(v, targetId);
+            }
+            // Nós que comprovadamente não alcançam o destino são descartados
+            if (this->potentials[v] == FLT_MAX)
+                continue;
+
+            float candidate = this->forwardDistances[u] + edgeWeights[e];
+            if (candidate < this->forwardDistances[v])
+            {
+                this->forwardDistances[v] = candidate;
+                if (this->forwardHeap->contains(v))
+                    this->forwardHeap->decreaseKey(v, candidate + this->potentials[v]);
+                else
+                    this->forwardHeap->push(v, candidate + this->potentials[v]);
+            }
+        }
+    }
+
+    return FLT_MAX;
+}
+
+// Métodos auxiliares
+//
+
+/****************
+ * Funcao    : bool isValid()                                                                   *
+ * Descricao : Verifica se as consultas são válidas, ou seja, se não há arestas de peso negativo *
+ * Parametros: Sem parâmetros.                                                                  *
+ * Retorno   : Retorna false se o grafo tem aresta de peso negativo.                            *
+ ***************/
+bool PointToPointQuery::isValid()
+{
+    return this->valid;
+}
+
+/****************
+ * Funcao    : void selectLandmarks()                                                                  *
+ * Descricao : Escolhe os landmarks pelo critério do mais distante: o primeiro é o nó mais distante do  *
+ *             nó 0 e cada seguinte maximiza a menor distância aos já escolhidos (nós inalcançáveis     *
+ *             têm prioridade). Guarda as distâncias de cada landmark a todos os nós e de todos os nós  *
+ *             a ele (grafo reverso).                                                                  *
+ * Parametros: Sem parâmetros.                                                                         *
+ * Retorno   : Sem retorno.                                                                            *
+ ***************/
+void PointToPointQuery::selectLandmarks()
+{
+    if (this->numLandmarks == 0)
+        return;
+
+    // Menor distância de cada nó aos landmarks escolhidos, começando pelo nó 0
+    float *nearest = new float[this->size];
+    this->forwardGraph->shortestPaths(0, nearest, this->forwardHeap, nullptr);
+
+    for (int l = 0; l < this->numLandmarks; l++)
+    {
+        // Nós ainda inalcançáveis são os mais distantes; senão, o de maior distância finita
+        int farthest = -1;
+        for (int v = 0; v < this->size && farthest < 0; v++)
+            if (nearest[v] == FLT_MAX)
+                farthest = v;
+        if (farthest < 0)
+        {
+            farthest = 0;
+            for (int v = 1; v < this->size; v++)
+                if (nearest[v] > nearest[farthest])
+                    farthest = v;
+        }
+        this->landmarks[l] = farthest;
+
+        float *from = this->fromLandmark + (size_t)l * this->size;
+        this->forwardGraph->shortestPaths(farthest, from, this->forwardHeap, nullptr);
+        if (this->toLandmark != this->fromLandmark)
+            this->backwardGraph->shortestPaths(farthest, this->toLandmark + (size_t)l * this->size, this->backwardHeap, nullptr);
+
+        for (int v = 0; v < this->size; v++)
+            if (l == 0 || from[v] < nearest[v])
+                nearest[v] = from[v];
+        nearest[farthest] = 0;
+    }
+
+    delete[] nearest;
+}
+
+/****************
+ * Funcao    : float landmarkLowerBound(int nodeId, int targetId)                                       *
+ * Descricao : Limite inferior de d(v, t) pela desigualdade triangular sobre cada landmark L:            *
+ *             d(L, t) - d(L, v) e d(v, L) - d(t, L), usando apenas distâncias finitas                  *
+ * Parametros: nodeId - id do nó v                                                                      *
+ *             targetId - id do destino t                                                               *
+ * Retorno   : Retorna o limite (>= 0), ou FLT_MAX se v comprovadamente não alcança t.                  *
+ ***************/
+float PointToPointQuery::landmarkLowerBound(int nodeId, int targetId)
+{
+    float bound = 0;
+    for (int l = 0; l < this->numLandmarks; l++)
+    {
+        const float *from = this->fromLandmark + (size_t)l * this->size;
+        const float *to = this->toLandmark + (size_t)l * this->size;
+        if (from[targetId] != FLT_MAX && from[nodeId] != FLT_MAX && from[targetId] - from[nodeId] > bound)
+            bound = from[targetId] - from[nodeId];
+        if (to[targetId] != FLT_MAX)
+        {
+            // t alcança L mas v não: v também não alcança t
+            if (to[nodeId] == FLT_MAX)
+                return FLT_MAX;
+            if (to[nodeId] - to[targetId] > bound)
+                bound = to[nodeId] - to[targetId];
+        }
+    }
+    return bound;
+}
+
+void PointToPointQuery::touch(int nodeId)
+{
+    this->touched[this->numTouched++] = nodeId;
+}
+
+/****************
+ * Funcao    : void resetWorkspace()                                                    *
+ * Descricao : Restaura apenas as posições tocadas pela consulta anterior               *
+ * Parametros: Sem parâmetros.                                                          *
+ * Retorno   : Sem retorno.                                                             *
+ ***************/
+void PointToPointQuery::resetWorkspace()
+{
+    for (int i = 0; i < this->numTouched; i++)
+    {
+        int v = this->touched[i];
+        this->forwardDistances[v] = FLT_MAX;
+        this->backwardDistances[v] = FLT_MAX;
+        this->potentials[v] = -1;
+    }
+    this->numTouched = 0;
+    this->forwardHeap->clear();
+    this->backwardHeap->clear();
+    this->settledNodes = 0;
+}
@@ -0,0 +1,67 @@
+/**************************************************************************************************
+ * Implementation of the TAD PointToPointQuery
+ **************************************************************************************************/
+
+#ifndef POINTTOPOINTQUERY_H_INCLUDED
+#define POINTTOPOINTQUERY_H_INCLUDED
+#include "CompactGraph.h"
+#include "IndexedHeap.h"
+
+using namespace std;
+
+class Graph;
+
+// Consultas de caminho mínimo entre um par de nós (s -> t), por Dijkstra bidirecional ou por A* com
+// landmarks (ALT). As distâncias aos landmarks são calculadas uma única vez, no construtor, e a área de
+// trabalho é reaproveitada entre consultas, de modo que cada consulta só toca os nós que visita.
+// Requer pesos de aresta não negativos. Não é seguro para uso entre threads.
+class PointToPointQuery
+{
+    // Atributos
+private:
+    int size;
+    bool valid;
+    CompactGraph *forwardGraph;
+    CompactGraph *backwardGraph;
+    int numLandmarks;
+    int *landmarks;
+    float *fromLandmark;
+    float *toLandmark;
+    float *forwardDistances;
+    float *backwardDistances;
+    float *potentials;
+    int *touched;
+    int numTouched;
+    IndexedHeap *forwardHeap;
+    IndexedHeap *backwardHeap;
+    int settledNodes;
+
+public:
+    // Construtor
+    PointToPointQuery(Graph *graph, int numLandmarks);
+
+    // Destrutor
+    ~PointToPointQuery();
+
+    // Getters
+    int getSize();
+    int getNumLandmarks();
+    int *getLandmarks();
+    int getSettledNodes();
+
+    // Métodos de consulta
+    float bidirectionalDijkstra(int sourceId, int targetId);
+    float aStarLandmarks(int sourceId, int targetId);
+
+    // Métodos auxiliares
+    bool isValid();
+
+private:
+    // Métodos auxiliares
+    void selectLandmarks();
+    float landmarkLowerBound(int nodeId, int targetId);
+    void touch(int nodeId);
+    void resetWorkspace();
+};
+
+#endif // POINTTOPOINTQUERY_H_INCLUDED
@@ -0,0 +1,95 @@
+#include "SolutionHashSet.h"
+
+using namespace std;
+
+// Capacidade máxima da tabela (potência de 2) e posições sondadas por assinatura
+static const int MAX_CAPACITY = 1 << 20;
+static const int MAX_PROBES = 16;
+
+/**************************************************************************************************
+ * Defining the SolutionHashSet's methods
+ **************************************************************************************************/
+
+/****************
+ * Funcao    : SolutionHashSet(int maxEntries)                                                 *
+ * Descricao : Aloca a tabela com a menor potência de 2 que comporta o dobro das entradas,     *
+ *             limitada a MAX_CAPACITY posições                                               *
+ * Parametros: maxEntries - quantidade esperada de assinaturas (uma por iteração)             *
+ ***************/
+SolutionHashSet::SolutionHashSet(int maxEntries)
+{
+    this->capacity = 16;
+    while (this->capacity < MAX_CAPACITY && this->capacity < 2 * (long long)maxEntries)
+        this->capacity *= 2;
+    this->slots = new atomic<unsigned long long>[this->capacity];
+    for (int i = 0; i < this->capacity; i++)
+        this->slots[i].store(0, memory_order_relaxed);
+}
+
+// Destrutor
+SolutionHashSet::~SolutionHashSet()
+{
+    delete[] this->slots;
+    this->slots = nullptr;
+    this->capacity = 0;
+}
+
+// Getters
+int SolutionHashSet::getCapacity()
+{
+    return this->capacity;
+}
+
+// Métodos de manipulação
+//
+
+/****************
+ * Funcao    : bool contains(unsigned long long hash)                                          *
+ * Descricao : Procura uma assinatura nas posições de sondagem, sem alterar o conjunto         *
+ * Parametros: hash - assinatura da solução; o valor 0, que marca posição vazia, vira 1        *
+ * Retorno   : Retorna true se a assinatura está no conjunto.                                 *
+ ***************/
+bool SolutionHashSet::contains(unsigned long long hash)
+{
+    if (hash == 0)
+        hash = 1;
+    int mask = this->capacity - 1;
+    for (int probe = 0; probe < MAX_PROBES; probe++)
+    {
+        unsigned long long current = this->slots[(hash + probe) & mask].load(memory_order_relaxed);
+        if (current == hash)
+            return true;
+        if (current == 0)
+            return false;
+    }
+    return false;
+}
+
+/****************
+ * Funcao    : bool insert(unsigned long long hash)                                            *
+ * Descricao : Guarda uma assinatura por sondagem linear, com troca atômica na posição vazia   *
+ * Parametros: hash - assinatura da solução; o valor 0, que marca posição vazia, vira 1        *
+ * Retorno   : Retorna false se a assinatura já estava no conjunto.                           *
+ ***************/
+bool SolutionHashSet::insert(unsigned long long hash)
+{
+    if (hash == 0)
+        hash = 1;
+    int mask = this->capacity - 1;
+    for (int probe = 0; probe < MAX_PROBES; probe++)
+    {
+        atomic<unsigned long long> *slot = &this->slots[(hash + probe) & mask];
+        unsigned long long current = slot->load(memory_order_relaxed);
+        if (current == hash)
+            return false;
+        if (current == 0)
+        {
+            if (slot->compare_exchange_strong(current, hash, memory_order_relaxed))
+                return true;
+            // Outra thread ocupou a posição; pode ter sido com a mesma assinatura
+            if (current == hash)
+                return false;
+        }
+    }
+    return true;
+}
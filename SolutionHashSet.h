@@ -0,0 +1,38 @@
+/**************************************************************************************************
+ * Implementation of the TAD SolutionHashSet
+ **************************************************************************************************/
+
+#ifndef SOLUTIONHASHSET_H_INCLUDED
+#define SOLUTIONHASHSET_H_INCLUDED
+#include <atomic>
+
+using namespace std;
+
+// Conjunto limitado, sem trava, das assinaturas (hashes Zobrist) das soluções já construídas pelo
+// GRASP, compartilhado pelas threads para reconhecer construções repetidas. Quando as posições de
+// sondagem de uma assinatura estão ocupadas, ela não é guardada e a solução é tratada como nova.
+// Os drivers só consultam o conjunto durante um bloco de iterações e inserem as assinaturas do bloco
+// ao fim dele, na ordem das iterações, para que a repetição não dependa do escalonamento.
+class SolutionHashSet
+{
+    // Atributos
+private:
+    int capacity;
+    atomic<unsigned long long> *slots;
+
+public:
+    // Construtor
+    SolutionHashSet(int maxEntries);
+
+    // Destrutor
+    ~SolutionHashSet();
+
+    // Getters
+    int getCapacity();
+
+    // Métodos de manipulação
+    bool contains(unsigned long long hash);
+    bool insert(unsigned long long hash);
+};
+
+#endif // SOLUTIONHASHSET_H_INCLUDED
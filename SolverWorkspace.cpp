@@ -0,0 +1,189 @@
+#include "SolverWorkspace.h"
+#include <cfloat>
+#include <climits>
+
+using namespace std;
+
+/****************
+ * Funcao    : unsigned long long zobristKey(int nodeId)                                   *
+ * Descricao : Chave pseudoaleatória fixa de um nó (splitmix64 do id); a assinatura de um  *
+ *             conjunto é o XOR das chaves dos seus nós, independente da ordem de inserção *
+ * Parametros: nodeId - id do nó                                                          *
+ * Retorno   : Retorna a chave do nó.                                                     *
+ ***************/
+static unsigned long long zobristKey(int nodeId)
+{
+    unsigned long long key = (unsigned long long)nodeId + 0x9E3779B97F4A7C15ULL;
+    key = (key ^ (key >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    key = (key ^ (key >> 27)) * 0x94D049BB133111EBULL;
+    return key ^ (key >> 31);
+}
+
+/**************************************************************************************************
+ * Defining the SolverWorkspace's methods
+ **************************************************************************************************/
+
+/****************
+ * Funcao    : SolverWorkspace(CoverageKernel *coverageKernel, CompactGraph *forwardGraph, CompactGraph *reverseGraph, const float *weights)*
+ * Descricao : Aloca toda a memória usada pelas iterações de uma thread                                     *
+ * Parametros: coverageKernel - vizinhanças em bits do grafo                                               *
+ *             forwardGraph - adjacências de saída, usadas pela busca local e pelo religamento             *
+ *             reverseGraph - adjacências de entrada, usadas pela busca local                              *
+ *             weights - peso de cada nó, indexado pelo id                                                 *
+ ***************/
+SolverWorkspace::SolverWorkspace(CoverageKernel *coverageKernel, CompactGraph *forwardGraph, CompactGraph *reverseGraph, const float *weights)
+{
+    this->size = coverageKernel->getSize();
+    this->uncovered = coverageKernel->createUncoveredSet();
+    this->candidates = new int[this->size];
+    this->scores = new float[this->size];
+    this->coveredIds = new int[this->size];
+    this->solution = new int[this->size];
+    this->bestSolution = new int[this->size];
+    this->relinkedSolution = new int[this->size];
+    this->solutionSize = 0;
+    this->solutionHash = 0;
+    this->bestSolutionSize = 0;
+    this->relinkedSolutionSize = 0;
+    this->bestKey = ULLONG_MAX;
+    this->localSearch = new LocalSearch(forwardGraph, reverseGraph, weights);
+    this->pathRelinking = new PathRelinking(forwardGraph, weights);
+}
+
+// Destrutor
+SolverWorkspace::~SolverWorkspace()
+{
+    freeBitset(this->uncovered);
+    delete[] this->candidates;
+    delete[] this->scores;
+    delete[] this->coveredIds;
+    delete[] this->solution;
+    delete[] this->bestSolution;
+    delete[] this->relinkedSolution;
+    delete this->localSearch;
+    delete this->pathRelinking;
+    this->uncovered = nullptr;
+    this->candidates = nullptr;
+    this->scores = nullptr;
+    this->coveredIds = nullptr;
+    this->solution = this->bestSolution = this->relinkedSolution = nullptr;
+    this->localSearch = nullptr;
+    this->pathRelinking = nullptr;
+    this->size = this->solutionSize = this->bestSolutionSize = this->relinkedSolutionSize = 0;
+}
+
+// Getters
+int SolverWorkspace::getSize()
+{
+    return this->size;
+}
+uint64_t *SolverWorkspace::getUncovered()
+{
+    return this->uncovered;
+}
+int *SolverWorkspace::getCandidates()
+{
+    return this->candidates;
+}
+float *SolverWorkspace::getScores()
+{
+    return this->scores;
+}
+int *SolverWorkspace::getCoveredIds()
+{
+    return this->coveredIds;
+}
+int *SolverWorkspace::getSolution()
+{
+    return this->solution;
+}
+int SolverWorkspace::getSolutionSize()
+{
+    return this->solutionSize;
+}
+unsigned long long SolverWorkspace::getSolutionHash()
+{
+    return this->solutionHash;
+}
+int *SolverWorkspace::getBestSolution()
+{
+    return this->bestSolution;
+}
+int SolverWorkspace::getBestSolutionSize()
+{
+    return this->bestSolutionSize;
+}
+unsigned long long SolverWorkspace::getBestKey()
+{
+    return this->bestKey;
+}
+
+// Métodos de manipulação
+//
+
+void SolverWorkspace::clearSolution()
+{
+    this->solutionSize = 0;
+    this->solutionHash = 0;
+}
+
+void SolverWorkspace::addNode(int nodeId)
+{
+    this->solution[this->solutionSize++] = nodeId;
+    this->solutionHash ^= zobristKey(nodeId);
+}
+
+/****************
+ * Funcao    : float improveSolution()                                       *
+ * Descricao : Leva a solução corrente a um ótimo local                      *
+ * Parametros: Sem parâmetros.                                               *
+ * Retorno   : Retorna o custo da solução melhorada.                         *
+ ***************/
+float SolverWorkspace::improveSolution()
+{
+    return this->localSearch->improve(this->solution, &this->solutionSize);
+}
+
+/****************
+ * Funcao    : float relinkSolution(const int *eliteSolution, int eliteSize, float currentCost)             *
+ * Descricao : Religa uma solução elite à solução corrente, partindo da elite, e leva a melhor solução      *
+ *             intermediária do caminho a um ótimo local; ela substitui a corrente se for mais barata       *
+ * Parametros: eliteSolution - ids dos nós da solução elite                                                *
+ *             eliteSize - quantidade de nós da solução elite                                              *
+ *             currentCost - custo da solução corrente                                                     *
+ * Retorno   : Retorna o custo da solução corrente ao final.                                               *
+ ***************/
+float SolverWorkspace::relinkSolution(const int *eliteSolution, int eliteSize, float currentCost)
+{
+    float relinkedCost = this->pathRelinking->relink(eliteSolution, eliteSize, this->solution, this->solutionSize, this->relinkedSolution, &this->relinkedSolutionSize);
+    if (relinkedCost == FLT_MAX)
+        return currentCost;
+    relinkedCost = this->localSearch->improve(this->relinkedSolution, &this->relinkedSolutionSize);
+    if (relinkedCost > currentCost - 1e-4)
+        return currentCost;
+    int *aux = this->solution;
+    this->solution = this->relinkedSolution;
+    this->relinkedSolution = aux;
+    this->solutionSize = this->relinkedSolutionSize;
+    return relinkedCost;
+}
+
+/****************
+ * Funcao    : bool keepIfBest(unsigned long long key)                                    *
+ * Descricao : Guarda a solução corrente como a melhor da thread se a sua chave for menor, *
+ *             trocando os vetores em vez de copiá-los                                    *
+ * Parametros: key - chave da solução corrente (custo e iteração)                         *
+ * Retorno   : Retorna true se a solução corrente passou a ser a melhor.                  *
+ ***************/
+bool SolverWorkspace::keepIfBest(unsigned long long key)
+{
+    if (key >= this->bestKey)
+        return false;
+    this->bestKey = key;
+    int *aux = this->bestSolution;
+    this->bestSolution = this->solution;
+    this->solution = aux;
+    this->bestSolutionSize = this->solutionSize;
+    this->solutionSize = 0;
+    return true;
+}
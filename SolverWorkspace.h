@@ -0,0 +1,66 @@
+/**************************************************************************************************
+ * Implementation of the TAD SolverWorkspace
+ **************************************************************************************************/
+
+#ifndef SOLVERWORKSPACE_H_INCLUDED
+#define SOLVERWORKSPACE_H_INCLUDED
+#include "CoverageKernel.h"
+#include "LocalSearch.h"
+#include "PathRelinking.h"
+
+using namespace std;
+
+// Área de trabalho de uma thread do GRASP, alocada uma vez por execução: candidatos da construção com
+// as suas pontuações, nós descobertos, busca local, religamento de caminhos e as soluções corrente e
+// melhor como vetores de ids, trocadas por ponteiro quando a corrente é melhor. Depois de criada, as
+// iterações não alocam memória. A solução corrente mantém, a cada nó adicionado, uma assinatura Zobrist
+// do conjunto construído.
+class SolverWorkspace
+{
+    // Atributos
+private:
+    int size;
+    uint64_t *uncovered;
+    int *candidates;
+    float *scores;
+    int *coveredIds;
+    int *solution;
+    int solutionSize;
+    unsigned long long solutionHash;
+    int *bestSolution;
+    int bestSolutionSize;
+    int *relinkedSolution;
+    int relinkedSolutionSize;
+    unsigned long long bestKey;
+    LocalSearch *localSearch;
+    PathRelinking *pathRelinking;
+
+public:
+    // Construtor
+    SolverWorkspace(CoverageKernel *coverageKernel, CompactGraph *forwardGraph, CompactGraph *reverseGraph, const float *weights);
+
+    // Destrutor
+    ~SolverWorkspace();
+
+    // Getters
+    int getSize();
+    uint64_t *getUncovered();
+    int *getCandidates();
+    float *getScores();
+    int *getCoveredIds();
+    int *getSolution();
+    int getSolutionSize();
+    unsigned long long getSolutionHash();
+    int *getBestSolution();
+    int getBestSolutionSize();
+    unsigned long long getBestKey();
+
+    // Métodos de manipulação
+    void clearSolution();
+    void addNode(int nodeId);
+    float improveSolution();
+    float relinkSolution(const int *eliteSolution, int eliteSize, float currentCost);
+    bool keepIfBest(unsigned long long key);
+};
+
+#endif // SOLVERWORKSPACE_H_INCLUDED
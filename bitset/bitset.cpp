@@ -0,0 +1,150 @@
+/*
+ * bitset.cpp
+ *
+ * Conjuntos de bits em palavras de 64 bits, com interseção e contagem vetorizadas
+ */
+
+#include "bitset.h"
+
+#include <cstdlib>
+#include <cstring>
+
+#if defined(__AVX512F__) || defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+using namespace std;
+
+// Alinhamento em bytes dos conjuntos (linha de cache)
+static const size_t BITSET_ALIGNMENT = 64;
+
+#if defined(__AVX2__) && !(defined(__AVX512F__) && defined(__AVX512VPOPCNTDQ__))
+/****************
+ * Funcao    : __m256i popcountWords(__m256i words)                                          *
+ * Descricao : Conta os bits de cada byte por consulta à tabela dos nibbles (vpshufb) e soma  *
+ *             os bytes de cada palavra de 64 bits                                           *
+ * Parametros: words - quatro palavras de 64 bits                                            *
+ * Retorno   : Quantidade de bits ligados em cada uma das quatro palavras.                   *
+ ***************/
+static inline __m256i popcountWords(__m256i words)
+{
+    const __m256i table = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                           0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    const __m256i lowMask = _mm256_set1_epi8(0x0F);
+    __m256i low = _mm256_and_si256(words, lowMask);
+    __m256i high = _mm256_and_si256(_mm256_srli_epi16(words, 4), lowMask);
+    __m256i counts = _mm256_add_epi8(_mm256_shuffle_epi8(table, low), _mm256_shuffle_epi8(table, high));
+    return _mm256_sad_epu8(counts, _mm256_setzero_si256());
+}
+
+// Soma as quatro palavras de 64 bits de um registrador
+static inline int sumWords(__m256i sums)
+{
+    return (int)(_mm256_extract_epi64(sums, 0) + _mm256_extract_epi64(sums, 1) +
+                 _mm256_extract_epi64(sums, 2) + _mm256_extract_epi64(sums, 3));
+}
+#endif
+
+/****************
+ * Funcao    : int bitsetWords(int size)                                                  *
+ * Descricao : Calcula a quantidade de palavras de um conjunto de size bits, completada   *
+ *             até um múltiplo de BITSET_BLOCK_WORDS                                      *
+ * Parametros: size - quantidade de elementos do universo                                 *
+ * Retorno   : Quantidade de palavras de 64 bits.                                         *
+ ***************/
+int bitsetWords(int size)
+{
+    int numWords = (size + 63) / 64;
+    numWords = ((numWords + BITSET_BLOCK_WORDS - 1) / BITSET_BLOCK_WORDS) * BITSET_BLOCK_WORDS;
+    return numWords > 0 ? numWords : BITSET_BLOCK_WORDS;
+}
+
+/****************
+ * Funcao    : uint64_t *allocBitset(size_t numWords)                   *
+ * Descricao : Aloca um conjunto vazio, alinhado à linha de cache       *
+ * Parametros: numWords - quantidade de palavras, obtida de bitsetWords  *
+ * Retorno   : Conjunto alocado, a ser liberado com freeBitset.          *
+ ***************/
+uint64_t *allocBitset(size_t numWords)
+{
+    uint64_t *bitset = (uint64_t *)aligned_alloc(BITSET_ALIGNMENT, numWords * sizeof(uint64_t));
+    memset(bitset, 0, numWords * sizeof(uint64_t));
+    return bitset;
+}
+
+/****************
+ * Funcao    : void freeBitset(uint64_t *bitset)                        *
+ * Descricao : Libera um conjunto alocado por allocBitset               *
+ * Parametros: bitset - conjunto a ser liberado                         *
+ * Retorno   : Sem retorno.                                             *
+ ***************/
+void freeBitset(uint64_t *bitset)
+{
+    free(bitset);
+}
+
+/****************
+ * Funcao    : void fillBitset(uint64_t *bitset, int size, int numWords)              *
+ * Descricao : Liga os bits 0..size-1 e desliga os de preenchimento                   *
+ * Parametros: bitset - conjunto a ser preenchido                                     *
+ *             size - quantidade de elementos do universo                             *
+ *             numWords - quantidade de palavras do conjunto                          *
+ * Retorno   : Sem retorno.                                                           *
+ ***************/
+void fillBitset(uint64_t *bitset, int size, int numWords)
+{
+    for (int w = 0; w < numWords; w++)
+    {
+        int bits = size - w * 64;
+        bitset[w] = bits >= 64 ? ~(uint64_t)0 : (bits > 0 ? ((uint64_t)1 << bits) - 1 : 0);
+    }
+}
+
+/****************
+ * Funcao    : int popcountBitset(const uint64_t *bitset, int numWords)   *
+ * Descricao : Conta os elementos de um conjunto                          *
+ * Parametros: bitset - conjunto                                          *
+ *             numWords - quantidade de palavras do conjunto              *
+ * Retorno   : Quantidade de bits ligados.                                *
+ ***************/
+int popcountBitset(const uint64_t *bitset, int numWords)
+{
+    int count = 0;
+    for (int w = 0; w < numWords; w++)
+        count += __builtin_popcountll(bitset[w]);
+    return count;
+}
+
+/****************
+ * Funcao    : int popcountAnd(const uint64_t *first, const uint64_t *second, int numWords)    *
+ * Descricao : Conta os elementos da interseção de dois conjuntos (AND + popcount)             *
+ * Parametros: first - primeiro conjunto                                                       *
+ *             second - segundo conjunto                                                       *
+ *             numWords - quantidade de palavras dos conjuntos                                 *
+ * Retorno   : Tamanho da interseção.                                                          *
+ ***************/
+int popcountAnd(const uint64_t *first, const uint64_t *second, int numWords)
+{
+#if defined(__AVX512F__) && defined(__AVX512VPOPCNTDQ__)
+    __m512i sums = _mm512_setzero_si512();
+    for (int w = 0; w < numWords; w += 8)
+    {
+        __m512i both = _mm512_and_si512(_mm512_load_si512(first + w), _mm512_load_si512(second + w));
+        sums = _mm512_add_epi64(sums, _mm512_popcnt_epi64(both));
+    }
+    return (int)_mm512_reduce_add_epi64(sums);
+#elif defined(__AVX2__)
+    __m256i sums = _mm256_setzero_si256();
+    for (int w = 0; w < numWords; w += 4)
+    {
+        __m256i both = _mm256_and_si256(_mm256_load_si256((const __m256i *)(first + w)), _mm256_load_si256((const __m256i *)(second + w)));
+        sums = _mm256_add_epi64(sums, popcountWords(both));
+    }
+    return sumWords(sums);
+#else
+    int count = 0;
+    for (int w = 0; w < numWords; w++)
+        count += __builtin_popcountll(first[w] & second[w]);
+    return count;
+#endif
+}
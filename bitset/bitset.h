@@ -0,0 +1,23 @@
+/*
+ * bitset.h
+ *
+ * Conjuntos de bits em palavras de 64 bits, com interseção e contagem vetorizadas
+ */
+
+#ifndef BITSET_H
+#define BITSET_H
+
+#include <cstddef>
+#include <cstdint>
+
+// Quantidade de palavras de 64 bits processadas por vez; os conjuntos são completados até um múltiplo dela
+#define BITSET_BLOCK_WORDS 8
+
+int bitsetWords(int size);
+uint64_t *allocBitset(size_t numWords);
+void freeBitset(uint64_t *bitset);
+void fillBitset(uint64_t *bitset, int size, int numWords);
+int popcountBitset(const uint64_t *bitset, int numWords);
+int popcountAnd(const uint64_t *first, const uint64_t *second, int numWords);
+
+#endif /* ifndef BITSET_H */
@@ -1,5 +1,8 @@
 #include "time/util.h"
 #include "Graph.h"
+#include "DominatingSetReduction.h"
+#include "ExactDominatingSet.h"
+#include "DominatingSetVerifier.h"
 #include <iostream>
 #include <iomanip>
 #include <stdlib.h>
@@ -11,6 +14,8 @@
 #include <sstream>
 #include <climits>
 #include <cfloat>
+#include <csignal>
+#include <cctype>
 
 using namespace std;
 
@@ -18,11 +23,16 @@ using namespace std;
 static const int OPTION_INVALID = -1;
 static const int OPTION_EXIT = 0;
 static const int OPTION_EXPORT = 1;
+// Tamanho padrão do conjunto elite do guloso randomizado reativo (0 desliga o religamento de caminhos,
+// que só é feito quando pedido com elite=K)
+static const int DEFAULT_ELITE_SIZE = 0;
 
 // Variáveis globais
 bool directed = false, weightedEdge = false, weightedNode = false;
 string input_file_name;
 CARDINAL seed;
+// Ligado por SIGINT/SIGTERM para encerrar os modos randomizados com a melhor solução já encontrada
+atomic<bool> cancelled(false);
 
 /****************
  * Funcao    : string formatFloat(float value, int precision, int totalLength)  	                *
@@ -69,6 +79,22 @@ string formatInt(int value, int totalLength)
     return returnString;
 }
 
+/****************
+ * Funcao    : string formatGap(float totalCost, float lowerBound)                                  *
+ * Descricao : Converte a distância relativa entre o custo de uma solução e o limite inferior em     *
+ *             porcentagem, indicando quando a solução é comprovadamente ótima                      *
+ * Parametros: totalCost - custo total da solução                                                   *
+ *             lowerBound - limite inferior do custo                                                *
+ * Retorno   : string formatada.                                                                    *
+ ***************/
+string formatGap(float totalCost, float lowerBound)
+{
+    float gap = totalCost > 0 ? 100 * (totalCost - lowerBound) / totalCost : 0;
+    if (gap <= 1e-4f)
+        return "0% (otimo comprovado)";
+    return to_string(gap) + "%";
+}
+
 /****************
  * Funcao    : string exportGraphToDotFormat(Graph *graph, bool isPERT) 	                        *
  * Descricao : Cria string com a descrição de um grafo no formato .DOT                              *
@@ -478,11 +504,12 @@ Graph *graphDifference(Graph *originalGraph, Graph *toSubtractGraph)
 }
 
 /****************
- * Funcao    : void printResultSet(string *returnText, list<SimpleNode> resultSet, float totalCost, double timeElapsed, CARDINAL seed, bool useSeed, float bestAlfa, bool useBestAlfa) *
+ * Funcao    : void printResultSet(string *returnText, list<SimpleNode> resultSet, float totalCost, float lowerBound, double timeElapsed, CARDINAL seed, bool useSeed, float bestAlfa, bool useBestAlfa) *
  * Descricao : Cria um texto com a descrição da execução de uma operação de algoritmos gulosos, inclusos os vértices elencados no conjunto solução                                     *
  * Parametros: returnText - texto construído a ser retornado                                                                                                                           *
  *             resultSet - conjunto solução do algoritmo                                                                                                                               *
  *             totalCost - custo total da solução                                                                                                                                      *
+ *             lowerBound - limite inferior do custo, para o gap da solução                                                                                                            *
  *             timeElapsed - tempo de CPU decorrido no experimento                                                                                                                     *
  *             seed - semente de randomização utilizada                                                                                                                                *
  *             useSeed - define se imprimirá a semente de randomização                                                                                                                 *
@@ -490,9 +517,11 @@ Graph *graphDifference(Graph *originalGraph, Graph *toSubtractGraph)
  *             useAlfa - define se imprimirá o melhor valor de alfa                                                                                                                    *
  * Retorno   : sem retorno.                                                                                                                                                            *
  ***************/
-void printResultSet(string *returnText, list<SimpleNode> resultSet, float totalCost, double timeElapsed, CARDINAL seed, bool useSeed, float bestAlfa, bool useBestAlfa)
+void printResultSet(string *returnText, list<SimpleNode> resultSet, float totalCost, float lowerBound, double timeElapsed, CARDINAL seed, bool useSeed, float bestAlfa, bool useBestAlfa)
 {
     *returnText += "Custo: " + to_string(totalCost) + "\n";
+    *returnText += "Limite inferior: " + to_string(lowerBound) + "\n";
+    *returnText += "Gap: " + formatGap(totalCost, lowerBound) + "\n";
     *returnText += "Vertices: " + to_string(resultSet.size()) + "\n";
     *returnText += "Tempo: " + to_string(timeElapsed) + "\n";
     if (useSeed)
@@ -505,11 +534,12 @@ void printResultSet(string *returnText, list<SimpleNode> resultSet, float totalC
 }
 
 /****************
- * Funcao    : void printResultVariables(string *returnText, int qtdNodes, float totalCost, double timeElapsed, CARDINAL seed, bool useSeed, float bestAlfa, bool useBestAlfa) *
+ * Funcao    : void printResultVariables(string *returnText, int qtdNodes, float totalCost, float lowerBound, double timeElapsed, CARDINAL seed, bool useSeed, float bestAlfa, bool useBestAlfa) *
  * Descricao : Cria um texto com a descrição da execução de uma operação de algoritmos gulosos, sem incluir os vértices elencados no conjunto solução                          *
  * Parametros: returnText - texto construído a ser retornado                                                                                                                   *
  *             qtdNodes - quantidade de vértices no conjunto solução do algoritmo                                                                                              *
  *             totalCost - custo total da solução                                                                                                                              *
+ *             lowerBound - limite inferior do custo, para o gap da solução                                                                                                    *
  *             timeElapsed - tempo de CPU decorrido no experimento                                                                                                             *
  *             seed - semente de randomização utilizada                                                                                                                        *
  *             useSeed - define se imprimirá a semente de randomização                                                                                                         *
@@ -517,9 +547,11 @@ void printResultSet(string *returnText, list<SimpleNode> resultSet, float totalC
  *             useAlfa - define se imprimirá o melhor valor de alfa                                                                                                            *
  * Retorno   : sem retorno.                                                                                                                                                    *
  ***************/
-void printResultVariables(string *returnText, int qtdNodes, float totalCost, double timeElapsed, CARDINAL seed, bool useSeed, float bestAlfa, bool useBestAlfa)
+void printResultVariables(string *returnText, int qtdNodes, float totalCost, float lowerBound, double timeElapsed, CARDINAL seed, bool useSeed, float bestAlfa, bool useBestAlfa)
 {
     *returnText += "Custo: " + to_string(totalCost) + "\n";
+    *returnText += "Limite inferior: " + to_string(lowerBound) + "\n";
+    *returnText += "Gap: " + formatGap(totalCost, lowerBound) + "\n";
     *returnText += "Vertices: " + to_string(qtdNodes) + "\n";
     *returnText += "Tempo: " + to_string(timeElapsed) + "\n";
     if (useSeed)
@@ -528,6 +560,34 @@ void printResultVariables(string *returnText, int qtdNodes, float totalCost, dou
         *returnText += "Melhor alfa: " + to_string(bestAlfa) + "\n";
 }
 
+/****************
+ * Funcao    : bool certifySolution(string *returnText, Graph *graph, list<SimpleNode> resultSet, float totalCost)  *
+ * Descricao : Confere, com o verificador de bits, se a solução domina o grafo e tem o custo informado, e acrescenta *
+ *             o resultado da verificação ao texto de saída                                                       *
+ * Parametros: returnText - texto construído a ser retornado                                                     *
+ *             graph - grafo do problema                                                                         *
+ *             resultSet - conjunto solução do algoritmo                                                         *
+ *             totalCost - custo total informado da solução                                                      *
+ * Retorno   : booleano que indica se a solução foi certificada.                                                 *
+ ***************/
+bool certifySolution(string *returnText, Graph *graph, list<SimpleNode> resultSet, float totalCost)
+{
+    DominatingSetVerifier *verifier = new DominatingSetVerifier(graph);
+    bool valid = verifier->verify(resultSet, totalCost, 0);
+    if (valid)
+        *returnText += "Verificacao: ok\n";
+    else
+    {
+        string failure = to_string(verifier->getNumberUncovered()) + " nos nao dominados, " +
+                         to_string(verifier->getNumberInvalid()) + " nos invalidos ou repetidos, custo verificado " +
+                         to_string(verifier->getVerifiedCost());
+        *returnText += "Verificacao: FALHOU (" + failure + ")\n";
+        cout << "ERRO: Solucao invalida: " << failure << "!" << endl;
+    }
+    delete verifier;
+    return valid;
+}
+
 /****************
  * Funcao    : bool verifyIfNodeCanBeUsedPredecessors(list<Edge *> predecessorEdges, bool *isInSolution, int nodeId) *
  * Descricao : Verifica se todos os predecessores de um nó estão na solução da PERT, e se o próprio já não está      *
@@ -834,6 +894,7 @@ int menu(string *errors, bool isSecondPart)
         cout << "[1] Guloso" << endl;
         cout << "[2] Guloso randomizado" << endl;
         cout << "[3] Guloso randomizado reativo" << endl;
+        cout << "[4] Guloso com ganho dinamico" << endl;
         cout << "[9] Imprimir grafo" << endl;
     }
     else
@@ -1003,7 +1064,8 @@ string selectOptionSecondPart(int *selectedOption, string *errors, Graph *graph)
         list<SimpleNode> resultSet = graph->dominatingSetWeighted(&totalCost);
         double finalTime = cpuTime();
         double timeElapsed = finalTime - intialTime;
-        printResultSet(&returnText, resultSet, totalCost, timeElapsed, 0, false, 0, false);
+        float lowerBound = graph->dominatingSetLowerBound();
+        printResultSet(&returnText, resultSet, totalCost, lowerBound, timeElapsed, 0, false, 0, false);
         break;
     }
     // Guloso randomizado
@@ -1019,10 +1081,12 @@ string selectOptionSecondPart(int *selectedOption, string *errors, Graph *graph)
 
         float totalCost = 0;
         double intialTime = cpuTime();
-        list<SimpleNode> resultSet = graph->dominatingSetWeightedRandomized(&totalCost, ::seed, numInter, alfa);
+        SearchStatistics statistics;
+        list<SimpleNode> resultSet = graph->dominatingSetWeightedRandomized(&totalCost, ::seed, numInter, alfa, 1, nullptr, &statistics);
         double finalTime = cpuTime();
         double timeElapsed = finalTime - intialTime;
-        printResultSet(&returnText, resultSet, totalCost, timeElapsed, ::seed, true, 0, false);
+        float lowerBound = statistics.lowerBound;
+        printResultSet(&returnText, resultSet, totalCost, lowerBound, timeElapsed, ::seed, true, 0, false);
         break;
     }
     // Guloso randomizado reativo
@@ -1055,14 +1119,28 @@ string selectOptionSecondPart(int *selectedOption, string *errors, Graph *graph)
         float totalCost = 0;
         double intialTime = cpuTime();
         float bestAlfa = 0;
-        list<SimpleNode> resultSet = graph->dominatingSetWeightedRandomizedReactive(&totalCost, ::seed, numInter, alfa, tam, bloco, &bestAlfa);
+        SearchStatistics statistics;
+        list<SimpleNode> resultSet = graph->dominatingSetWeightedRandomizedReactive(&totalCost, ::seed, numInter, alfa, tam, bloco, &bestAlfa, DEFAULT_ELITE_SIZE, 1, nullptr, &statistics);
         double finalTime = cpuTime();
         double timeElapsed = finalTime - intialTime;
-        printResultSet(&returnText, resultSet, totalCost, timeElapsed, ::seed, true, bestAlfa, true);
+        float lowerBound = statistics.lowerBound;
+        printResultSet(&returnText, resultSet, totalCost, lowerBound, timeElapsed, ::seed, true, bestAlfa, true);
 
         delete[] alfa;
         break;
     }
+    // Guloso com ganho dinâmico
+    case 4:
+    {
+        float totalCost = 0;
+        double intialTime = cpuTime();
+        list<SimpleNode> resultSet = graph->dominatingSetWeightedDynamic(&totalCost);
+        double finalTime = cpuTime();
+        double timeElapsed = finalTime - intialTime;
+        float lowerBound = graph->dominatingSetLowerBound();
+        printResultSet(&returnText, resultSet, totalCost, lowerBound, timeElapsed, 0, false, 0, false);
+        break;
+    }
     // Impressão
     case 9:
     {
@@ -1123,6 +1201,57 @@ int mainMenu(string outputFileName, Graph *graph, bool isSecondPart)
     return 0;
 }
 
+/****************
+ * Funcao    : bool readOption(int argc, char const *argv[], int firstIndex, string key, string *value)   *
+ * Descricao : Procura, entre os argumentos opcionais no formato chave=valor, o valor de uma chave       *
+ * Parametros: argc - quantidade de argumentos passados na linha de comando                              *
+ *             argv - vetor dos argumentos passados pela linha de comando                                *
+ *             firstIndex - posição do primeiro argumento opcional                                      *
+ *             key - chave procurada                                                                    *
+ *             value - endereço que guardará o valor da chave, se encontrada                            *
+ * Retorno   : booleano que indica se a chave foi encontrada.                                           *
+ ***************/
+bool readOption(int argc, char const *argv[], int firstIndex, string key, string *value)
+{
+    for (int i = firstIndex; i < argc; i++)
+    {
+        string argument(argv[i]);
+        if (argument.compare(0, key.length() + 1, key + "=") == 0)
+        {
+            *value = argument.substr(key.length() + 1);
+            return true;
+        }
+    }
+    return false;
+}
+
+// Tratador de SIGINT/SIGTERM: pede a parada dos modos randomizados
+void cancelExecution(int /*signalNumber*/)
+{
+    cancelled.store(true);
+}
+
+/****************
+ * Funcao    : void readStoppingCriteria(int argc, char const *argv[], int firstIndex, StoppingCriteria *stoppingCriteria)*
+ * Descricao : Lê os critérios de parada opcionais dos modos randomizados (tempo=segundos, alvo=custo e        *
+ *             estagnacao=iterações) e associa o cancelamento por SIGINT/SIGTERM                              *
+ * Parametros: argc - quantidade de argumentos passados na linha de comando                                   *
+ *             argv - vetor dos argumentos passados pela linha de comando                                     *
+ *             firstIndex - posição do primeiro argumento opcional                                           *
+ *             stoppingCriteria - endereço que guardará os critérios lidos                                   *
+ * Retorno   : Sem retorno.                                                                                  *
+ ***************/
+void readStoppingCriteria(int argc, char const *argv[], int firstIndex, StoppingCriteria *stoppingCriteria)
+{
+    string value;
+    stoppingCriteria->timeLimit = readOption(argc, argv, firstIndex, "tempo", &value) ? atof(value.c_str()) : 0;
+    stoppingCriteria->targetCost = readOption(argc, argv, firstIndex, "alvo", &value) ? atof(value.c_str()) : -1;
+    stoppingCriteria->maxStagnation = readOption(argc, argv, firstIndex, "estagnacao", &value) ? atoi(value.c_str()) : 0;
+    stoppingCriteria->cancelled = &cancelled;
+    signal(SIGINT, cancelExecution);
+    signal(SIGTERM, cancelExecution);
+}
+
 /*  Verifies each parameter of the command line,
  *   if it is set properly calls menu function
  *   else it shows the expected model just beforing ending the program
@@ -1137,7 +1266,7 @@ int mainMenu(string outputFileName, Graph *graph, bool isSecondPart)
 int main(int argc, char const *argv[])
 {
     // Verifica se todos os argumentos foram fornecidos
-    if (argc == 3 || argc == 4 || argc == 6 || argc >= 8)
+    if (argc >= 3)
     {
         int endingCode = 0;
         ::seed = (unsigned)(time(NULL) & 0xFFFF) | (getpid() << 16);
@@ -1157,7 +1286,8 @@ int main(int argc, char const *argv[])
         if (input_file.is_open())
         {
             // Executa versão adequada do programa
-            if (argc == 6 && atoi(argv[3]) != 2)
+            // A primeira parte recebe três flags numéricas; a segunda aceita opções nomeadas no mesmo número de argumentos
+            if (argc == 6 && atoi(argv[3]) != 2 && atoi(argv[3]) != 4 && isdigit(argv[4][0]) && isdigit(argv[5][0]))
             {
                 graph = readFileFirstPart(input_file, atoi(argv[3]), atoi(argv[4]), atoi(argv[5]), false);
                 endingCode = mainMenu(output_file_name, graph, false);
@@ -1173,39 +1303,197 @@ int main(int argc, char const *argv[])
                     string returnText = "";
                     float totalCost = 0;
                     // Guloso
-                    if (argc == 4)
+                    if (atoi(argv[3]) == 1 && argc >= 4)
                     {
-                        // program input output 1
+                        // program input output 1 [dinamico] [reducao=sim]
+                        string value;
+                        bool dynamicGain = argc >= 5 && string(argv[4]) == "dinamico";
+                        bool useReduction = readOption(argc, argv, 4, "reducao", &value) && value == "sim";
                         double intialTime = cpuTime();
-                        list<SimpleNode> resultSet = graph->dominatingSetWeighted(&totalCost);
+                        DominatingSetReduction *reduction = useReduction ? new DominatingSetReduction(graph) : nullptr;
+                        Graph *solverGraph = useReduction ? reduction->getResidualGraph() : graph;
+                        list<SimpleNode> resultSet = dynamicGain ? solverGraph->dominatingSetWeightedDynamic(&totalCost) : solverGraph->dominatingSetWeighted(&totalCost);
+                        if (useReduction)
+                        {
+                            resultSet = reduction->liftSolution(resultSet, &totalCost);
+                            delete reduction;
+                        }
                         double finalTime = cpuTime();
                         double timeElapsed = finalTime - intialTime;
-                        printResultVariables(&returnText, resultSet.size(), totalCost, timeElapsed, 0, false, 0, false);
+                        // O limite inferior é calculado no grafo original, fora do tempo medido
+                        float lowerBound = graph->dominatingSetLowerBound();
+                        printResultVariables(&returnText, resultSet.size(), totalCost, lowerBound, timeElapsed, 0, false, 0, false);
+                        certifySolution(&returnText, graph, resultSet, totalCost);
                     }
-                    else if (argc == 6)
+                    else if (atoi(argv[3]) == 2 && argc >= 6)
                     {
-                        // program input output 2 numIterations alfa
-                        double intialTime = cpuTime();
-                        list<SimpleNode> resultSet = graph->dominatingSetWeightedRandomized(&totalCost, ::seed, atoi(argv[4]), atof(argv[5]));
-                        double finalTime = cpuTime();
+                        // program input output 2 numIterations alfa [threads=N] [semente=N] [tempo=S] [alvo=C] [estagnacao=N] [reducao=sim]
+                        string value;
+                        int numThreads = readOption(argc, argv, 6, "threads", &value) ? atoi(value.c_str()) : 1;
+                        if (readOption(argc, argv, 6, "semente", &value))
+                            ::seed = strtoul(value.c_str(), nullptr, 10);
+                        StoppingCriteria stoppingCriteria;
+                        SearchStatistics statistics;
+                        readStoppingCriteria(argc, argv, 6, &stoppingCriteria);
+                        bool useReduction = readOption(argc, argv, 6, "reducao", &value) && value == "sim";
+
+                        // Com várias threads, mede-se o tempo de relógio
+                        double intialTime = numThreads == 1 ? cpuTime() : wallClock();
+                        DominatingSetReduction *reduction = useReduction ? new DominatingSetReduction(graph) : nullptr;
+                        Graph *solverGraph = useReduction ? reduction->getResidualGraph() : graph;
+                        // O alvo vale para a solução completa, que inclui os nós forçados pela redução
+                        if (useReduction && stoppingCriteria.targetCost >= 0)
+                            stoppingCriteria.targetCost = max(stoppingCriteria.targetCost - reduction->getForcedCost(), 0.0f);
+                        list<SimpleNode> resultSet = solverGraph->dominatingSetWeightedRandomized(&totalCost, ::seed, atoi(argv[4]), atof(argv[5]), numThreads, &stoppingCriteria, &statistics);
+                        float forcedCost = useReduction ? reduction->getForcedCost() : 0;
+                        if (useReduction)
+                        {
+                            resultSet = reduction->liftSolution(resultSet, &totalCost);
+                            delete reduction;
+                        }
+                        double finalTime = numThreads == 1 ? cpuTime() : wallClock();
                         double timeElapsed = finalTime - intialTime;
-                        printResultVariables(&returnText, resultSet.size(), totalCost, timeElapsed, ::seed, true, 0, false);
+                        // Limite inferior calculado pelo driver; no grafo reduzido, somam-se os nós forçados
+                        float lowerBound = statistics.lowerBound;
+                        if (useReduction)
+                            lowerBound = min(lowerBound + forcedCost, totalCost);
+                        printResultVariables(&returnText, resultSet.size(), totalCost, lowerBound, timeElapsed, ::seed, true, 0, false);
+                        returnText += "Iteracoes: " + to_string(statistics.numberIterations) + "\n";
+                        returnText += "Construcoes repetidas: " + to_string(statistics.numberDuplicates) + "\n";
+                        certifySolution(&returnText, graph, resultSet, totalCost);
                     }
-                    else if (argc >= 8)
+                    else if (atoi(argv[3]) == 3 && argc >= 8)
                     {
-                        // program input output 3 numIterations block numAlfas alfas...
+                        // program input output 3 numIterations block numAlfas alfas... [threads=N] [semente=N] [tempo=S] [alvo=C] [estagnacao=N] [reducao=sim] [elite=K]
                         int numAlfas = atoi(argv[6]);
                         float *vetAlfas = new float[numAlfas];
                         for (int i = 7; i < 7 + numAlfas; i++)
                             vetAlfas[i - 7] = atof(argv[i]);
 
-                        double intialTime = cpuTime();
+                        string value;
+                        int numThreads = readOption(argc, argv, 7 + numAlfas, "threads", &value) ? atoi(value.c_str()) : 1;
+                        if (readOption(argc, argv, 7 + numAlfas, "semente", &value))
+                            ::seed = strtoul(value.c_str(), nullptr, 10);
+                        StoppingCriteria stoppingCriteria;
+                        SearchStatistics statistics;
+                        readStoppingCriteria(argc, argv, 7 + numAlfas, &stoppingCriteria);
+                        bool useReduction = readOption(argc, argv, 7 + numAlfas, "reducao", &value) && value == "sim";
+                        int eliteSize = readOption(argc, argv, 7 + numAlfas, "elite", &value) ? atoi(value.c_str()) : DEFAULT_ELITE_SIZE;
+
+                        // Com várias threads, mede-se o tempo de relógio
+                        double intialTime = numThreads == 1 ? cpuTime() : wallClock();
                         float bestAlfa = 0;
-                        list<SimpleNode> resultSet = graph->dominatingSetWeightedRandomizedReactive(&totalCost, ::seed, atoi(argv[4]), vetAlfas, atoi(argv[6]), atoi(argv[5]), &bestAlfa);
-                        double finalTime = cpuTime();
+                        DominatingSetReduction *reduction = useReduction ? new DominatingSetReduction(graph) : nullptr;
+                        Graph *solverGraph = useReduction ? reduction->getResidualGraph() : graph;
+                        if (useReduction && stoppingCriteria.targetCost >= 0)
+                            stoppingCriteria.targetCost = max(stoppingCriteria.targetCost - reduction->getForcedCost(), 0.0f);
+                        list<SimpleNode> resultSet = solverGraph->dominatingSetWeightedRandomizedReactive(&totalCost, ::seed, atoi(argv[4]), vetAlfas, atoi(argv[6]), atoi(argv[5]), &bestAlfa, eliteSize, numThreads, &stoppingCriteria, &statistics);
+                        float forcedCost = useReduction ? reduction->getForcedCost() : 0;
+                        if (useReduction)
+                        {
+                            resultSet = reduction->liftSolution(resultSet, &totalCost);
+                            delete reduction;
+                        }
+                        double finalTime = numThreads == 1 ? cpuTime() : wallClock();
+                        double timeElapsed = finalTime - intialTime;
+                        // Limite inferior calculado pelo driver; no grafo reduzido, somam-se os nós forçados
+                        float lowerBound = statistics.lowerBound;
+                        if (useReduction)
+                            lowerBound = min(lowerBound + forcedCost, totalCost);
+                        printResultVariables(&returnText, resultSet.size(), totalCost, lowerBound, timeElapsed, ::seed, true, bestAlfa, true);
+                        returnText += "Iteracoes: " + to_string(statistics.numberIterations) + "\n";
+                        returnText += "Construcoes repetidas: " + to_string(statistics.numberDuplicates) + "\n";
+                        returnText += "Religamentos com melhora: " + to_string(statistics.numberRelinked) + "\n";
+                        certifySolution(&returnText, graph, resultSet, totalCost);
+                    }
+                    else if (atoi(argv[3]) == 4 && argc >= 6)
+                    {
+                        // program input output 4 numIterations destroyFraction [threads=N] [semente=N] [tempo=S] [alvo=C] [estagnacao=N] [reducao=sim]
+                        string value;
+                        int numThreads = readOption(argc, argv, 6, "threads", &value) ? atoi(value.c_str()) : 1;
+                        if (readOption(argc, argv, 6, "semente", &value))
+                            ::seed = strtoul(value.c_str(), nullptr, 10);
+                        StoppingCriteria stoppingCriteria;
+                        SearchStatistics statistics;
+                        readStoppingCriteria(argc, argv, 6, &stoppingCriteria);
+                        bool useReduction = readOption(argc, argv, 6, "reducao", &value) && value == "sim";
+
+                        // Com várias threads, mede-se o tempo de relógio
+                        double intialTime = numThreads == 1 ? cpuTime() : wallClock();
+                        DominatingSetReduction *reduction = useReduction ? new DominatingSetReduction(graph) : nullptr;
+                        Graph *solverGraph = useReduction ? reduction->getResidualGraph() : graph;
+                        if (useReduction && stoppingCriteria.targetCost >= 0)
+                            stoppingCriteria.targetCost = max(stoppingCriteria.targetCost - reduction->getForcedCost(), 0.0f);
+                        list<SimpleNode> resultSet = solverGraph->dominatingSetIteratedGreedy(&totalCost, ::seed, atoi(argv[4]), atof(argv[5]), numThreads, &stoppingCriteria, &statistics);
+                        float forcedCost = useReduction ? reduction->getForcedCost() : 0;
+                        if (useReduction)
+                        {
+                            resultSet = reduction->liftSolution(resultSet, &totalCost);
+                            delete reduction;
+                        }
+                        double finalTime = numThreads == 1 ? cpuTime() : wallClock();
+                        double timeElapsed = finalTime - intialTime;
+                        // Limite inferior calculado pelo driver; no grafo reduzido, somam-se os nós forçados
+                        float lowerBound = statistics.lowerBound;
+                        if (useReduction)
+                            lowerBound = min(lowerBound + forcedCost, totalCost);
+                        printResultVariables(&returnText, resultSet.size(), totalCost, lowerBound, timeElapsed, ::seed, true, 0, false);
+                        returnText += "Iteracoes: " + to_string(statistics.numberIterations) + "\n";
+                        certifySolution(&returnText, graph, resultSet, totalCost);
+                    }
+                    else if (atoi(argv[3]) == 5 && argc >= 4)
+                    {
+                        // program input output 5 [threads=N] [tempo=S] [alvo=C] [reducao=sim]
+                        string value;
+                        int numThreads = readOption(argc, argv, 4, "threads", &value) ? atoi(value.c_str()) : 1;
+                        StoppingCriteria stoppingCriteria;
+                        readStoppingCriteria(argc, argv, 4, &stoppingCriteria);
+                        bool useReduction = readOption(argc, argv, 4, "reducao", &value) && value == "sim";
+
+                        // Com várias threads, mede-se o tempo de relógio
+                        double intialTime = numThreads == 1 ? cpuTime() : wallClock();
+                        DominatingSetReduction *reduction = useReduction ? new DominatingSetReduction(graph) : nullptr;
+                        Graph *solverGraph = useReduction ? reduction->getResidualGraph() : graph;
+                        if (useReduction && stoppingCriteria.targetCost >= 0)
+                            stoppingCriteria.targetCost = max(stoppingCriteria.targetCost - reduction->getForcedCost(), 0.0f);
+                        ExactDominatingSet *exactSolver = new ExactDominatingSet(solverGraph);
+                        list<SimpleNode> resultSet = exactSolver->solve(&totalCost, numThreads, &stoppingCriteria);
+                        float lowerBound = exactSolver->getLowerBound();
+                        if (useReduction)
+                        {
+                            lowerBound += reduction->getForcedCost();
+                            resultSet = reduction->liftSolution(resultSet, &totalCost);
+                            delete reduction;
+                        }
+                        double finalTime = numThreads == 1 ? cpuTime() : wallClock();
                         double timeElapsed = finalTime - intialTime;
-                        printResultVariables(&returnText, resultSet.size(), totalCost, timeElapsed, ::seed, true, bestAlfa, true);
+                        // A solução levada de volta pela redução pode ficar abaixo do custo do grafo reduzido
+                        lowerBound = min(lowerBound, totalCost);
+                        printResultVariables(&returnText, resultSet.size(), totalCost, lowerBound, timeElapsed, 0, false, 0, false);
+                        returnText += "Nos explorados: " + to_string(exactSolver->getNumberNodes()) + "\n";
+                        certifySolution(&returnText, graph, resultSet, totalCost);
+                        delete exactSolver;
+                    }
+                    else if (string(argv[3]) == "verificar" && argc >= 5)
+                    {
+                        // program input output verificar solution_file
+                        ifstream solutionFile(argv[4], ios::in);
+                        if (solutionFile.is_open())
+                        {
+                            DominatingSetVerifier *verifier = new DominatingSetVerifier(graph);
+                            bool valid = verifier->verifyFile(solutionFile, 0);
+                            returnText += "Custo verificado: " + to_string(verifier->getVerifiedCost()) + "\n";
+                            returnText += "Nos nao dominados: " + to_string(verifier->getNumberUncovered()) + "\n";
+                            returnText += "Nos invalidos ou repetidos: " + to_string(verifier->getNumberInvalid()) + "\n";
+                            returnText += string("Verificacao: ") + (valid ? "ok" : "FALHOU") + "\n";
+                            delete verifier;
+                            solutionFile.close();
+                        }
+                        else
+                            cout << "ERRO: Não foi possível abrir o arquivo de solução " << argv[4] << "!" << endl;
                     }
+                    else
+                        cout << "ERRO: Argumentos invalidos para o modo " << argv[3] << "!" << endl;
                     ofstream output_file;
                     output_file.open(output_file_name, ios::out | ios::trunc);
                     output_file << returnText;
@@ -0,0 +1,229 @@
+/*
+ * matrix.cpp
+ *
+ * Matriz de distâncias contígua e alinhada, com kernels min-plus em blocos
+ */
+
+#include "matrix.h"
+#include "../thread/parallel.h"
+
+#include <cfloat>
+#include <cstdlib>
+#include <cstring>
+
+#if defined(__AVX512F__) || defined(__AVX__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+using namespace std;
+
+// Alinhamento em bytes do bloco de memória (linha de cache)
+static const size_t MATRIX_ALIGNMENT = 64;
+
+/****************
+ * Funcao    : float **allocMatrix(int size, int *stride)                                               *
+ * Descricao : Aloca uma matriz size x size em um único bloco alinhado. Cada linha é completada até um   *
+ *             múltiplo de MATRIX_BLOCK, e as linhas e colunas de preenchimento valem FLT_MAX, com 0 na  *
+ *             diagonal, de modo que não interferem no cálculo dos caminhos mínimos.                    *
+ * Parametros: size - quantidade de linhas (e colunas) úteis da matriz                                  *
+ *             stride - endereço que guardará a distância, em floats, entre duas linhas consecutivas    *
+ * Retorno   : Vetor de size ponteiros para as linhas, todas dentro do mesmo bloco contíguo.            *
+ ***************/
+float **allocMatrix(int size, int *stride)
+{
+    int padded = ((size + MATRIX_BLOCK - 1) / MATRIX_BLOCK) * MATRIX_BLOCK;
+    if (padded == 0)
+        padded = MATRIX_BLOCK;
+    *stride = padded;
+
+    size_t bytes = (size_t)padded * padded * sizeof(float);
+    float *buffer = (float *)aligned_alloc(MATRIX_ALIGNMENT, bytes);
+    for (size_t i = 0; i < (size_t)padded * padded; i++)
+        buffer[i] = FLT_MAX;
+    for (int i = 0; i < padded; i++)
+        buffer[(size_t)i * padded + i] = 0;
+
+    // O vetor de linhas tem ao menos uma posição, para que matrix[0] sempre aponte para o bloco
+    float **matrix = new float *[size > 0 ? size : 1];
+    matrix[0] = buffer;
+    for (int i = 1; i < size; i++)
+        matrix[i] = buffer + (size_t)i * padded;
+    return matrix;
+}
+
+/****************
+ * Funcao    : void freeMatrix(float **matrix)                  *
+ * Descricao : Libera uma matriz alocada por allocMatrix        *
+ * Parametros: matrix - matriz a ser liberada                   *
+ * Retorno   : Sem retorno.                                     *
+ ***************/
+void freeMatrix(float **matrix)
+{
+    if (matrix == nullptr)
+        return;
+    free(matrix[0]);
+    delete[] matrix;
+}
+
+/****************
+ * Funcao    : void minPlusBlock(float *target, const float *left, const float *right, int stride)             *
+ * Descricao : Relaxa um bloco MATRIX_BLOCK x MATRIX_BLOCK pelo produto min-plus de outros dois:                *
+ *             target[i][j] = min(target[i][j], left[i][k] + right[k][j]), com k mais externo. Os blocos podem  *
+ *             coincidir (fases 1 e 2 do Floyd-Warshall em blocos), pois a iteração k não altera a linha nem a  *
+ *             coluna k quando não há ciclos negativos.                                                          *
+ * Parametros: target - primeiro elemento do bloco atualizado                                                   *
+ *             left - primeiro elemento do bloco que fornece os caminhos i -> k                                 *
+ *             right - primeiro elemento do bloco que fornece os caminhos k -> j                                *
+ *             stride - distância, em floats, entre duas linhas da matriz                                       *
+ * Retorno   : Sem retorno.                                                                                     *
+ ***************/
+void minPlusBlock(float *target, const float *left, const float *right, int stride)
+{
+    for (int k = 0; k < MATRIX_BLOCK; k++)
+    {
+        const float *rightRow = right + (size_t)k * stride;
+        for (int i = 0; i < MATRIX_BLOCK; i++)
+        {
+            float *targetRow = target + (size_t)i * stride;
+            float pathToK = left[(size_t)i * stride + k];
+            if (pathToK == FLT_MAX)
+                continue;
+#if defined(__AVX512F__)
+            __m512 broadcast = _mm512_set1_ps(pathToK);
+            for (int j = 0; j < MATRIX_BLOCK; j += 16)
+            {
+                __m512 pathUsingK = _mm512_add_ps(broadcast, _mm512_load_ps(rightRow + j));
+                _mm512_store_ps(targetRow + j, _mm512_min_ps(_mm512_load_ps(targetRow + j), pathUsingK));
+            }
+#elif defined(__AVX__)
+            __m256 broadcast = _mm256_set1_ps(pathToK);
+            for (int j = 0; j < MATRIX_BLOCK; j += 8)
+            {
+                __m256 pathUsingK = _mm256_add_ps(broadcast, _mm256_load_ps(rightRow + j));
+                _mm256_store_ps(targetRow + j, _mm256_min_ps(_mm256_load_ps(targetRow + j), pathUsingK));
+            }
+#elif defined(__SSE2__)
+            __m128 broadcast = _mm_set1_ps(pathToK);
+            for (int j = 0; j < MATRIX_BLOCK; j += 4)
+            {
+                __m128 pathUsingK = _mm_add_ps(broadcast, _mm_load_ps(rightRow + j));
+                _mm_store_ps(targetRow + j, _mm_min_ps(_mm_load_ps(targetRow + j), pathUsingK));
+            }
+#else
+            for (int j = 0; j < MATRIX_BLOCK; j++)
+            {
+                float pathUsingK = pathToK + rightRow[j];
+                if (pathUsingK < targetRow[j])
+                    targetRow[j] = pathUsingK;
+            }
+#endif
+        }
+    }
+}
+
+/****************
+ * Funcao    : void minPlusMultiply(float *target, const float *left, const float *right, int size, int stride, int numThreads)*
+ * Descricao : Relaxa uma submatriz size x size pelo produto min-plus de outras duas, bloco a bloco:                *
+ *             target = min(target, left ⊗ right). O alvo pode coincidir com left ou right quando a outra matriz     *
+ *             é um pivô já fechado pelo Floyd-Warshall; nesse caso, a cada k, a linha (ou coluna) de blocos lida    *
+ *             pelos demais é atualizada antes, e as restantes são distribuídas entre as threads.                   *
+ * Parametros: target - primeiro elemento da submatriz atualizada                                                   *
+ *             left - primeiro elemento da submatriz que fornece os caminhos i -> k                                 *
+ *             right - primeiro elemento da submatriz que fornece os caminhos k -> j                                *
+ *             size - lado das submatrizes, múltiplo de MATRIX_BLOCK                                                *
+ *             stride - distância, em floats, entre duas linhas das submatrizes                                     *
+ *             numThreads - quantidade de threads                                                                   *
+ * Retorno   : Sem retorno.                                                                                         *
+ ***************/
+void minPlusMultiply(float *target, const float *left, const float *right, int size, int stride, int numThreads)
+{
+    int blocks = size / MATRIX_BLOCK;
+    size_t blockRow = (size_t)MATRIX_BLOCK * stride;
+    bool aliasRight = target == right;
+    bool aliasLeft = target == left;
+
+    for (int kb = 0; kb < blocks; kb++)
+    {
+        auto relax = [&](int ib, int jb)
+        {
+            minPlusBlock(target + ib * blockRow + jb * MATRIX_BLOCK,
+                         left + ib * blockRow + kb * MATRIX_BLOCK,
+                         right + kb * blockRow + jb * MATRIX_BLOCK, stride);
+        };
+
+        // Blocos lidos pelos demais nesta iteração: linha kb (alvo = right) ou coluna kb (alvo = left)
+        if (aliasRight || aliasLeft)
+            parallelFor(blocks, numThreads, [&](int b, int /*thread*/)
+                        {
+                            if (aliasRight)
+                                relax(kb, b);
+                            else
+                                relax(b, kb); });
+
+        parallelFor(blocks * blocks, numThreads, [&](int task, int /*thread*/)
+                    {
+                        int ib = task / blocks;
+                        int jb = task % blocks;
+                        if ((aliasRight && ib == kb) || (aliasLeft && jb == kb))
+                            return;
+                        relax(ib, jb); });
+    }
+}
+
+/****************
+ * Funcao    : void floydWarshallBlocked(float **matrix, int size, int stride, int numThreads)          *
+ * Descricao : Executa o Floyd-Warshall em blocos, no próprio lugar. Para cada bloco diagonal kb:        *
+ *             (1) fecha o bloco (kb, kb); (2) relaxa os blocos da linha e da coluna kb; (3) relaxa os    *
+ *             demais blocos (i, j) por (i, kb) e (kb, j). Cada fase trabalha sobre blocos que cabem na   *
+ *             cache, em vez de percorrer a matriz inteira a cada k. Os blocos de uma mesma fase são      *
+ *             independentes e são distribuídos entre as threads.                                         *
+ * Parametros: matrix - matriz alocada por allocMatrix, já com as distâncias iniciais                    *
+ *             size - quantidade de linhas úteis da matriz                                               *
+ *             stride - distância, em floats, entre duas linhas da matriz                                *
+ *             numThreads - quantidade de threads                                                        *
+ * Retorno   : Sem retorno.                                                                              *
+ ***************/
+void floydWarshallBlocked(float **matrix, int size, int stride, int numThreads)
+{
+    if (size == 0)
+        return;
+    float *buffer = matrix[0];
+    int blocks = stride / MATRIX_BLOCK;
+    size_t blockRow = (size_t)MATRIX_BLOCK * stride;
+
+    for (int kb = 0; kb < blocks; kb++)
+    {
+        float *pivot = buffer + kb * blockRow + kb * MATRIX_BLOCK;
+
+        // Fase 1: bloco diagonal
+        minPlusBlock(pivot, pivot, pivot, stride);
+
+        // Fase 2: blocos da linha e da coluna do pivô
+        parallelFor(2 * blocks, numThreads, [&](int task, int /*thread*/)
+                    {
+                        int b = task / 2;
+                        if (b == kb)
+                            return;
+                        if (task % 2 == 0)
+                        {
+                            float *rowBlock = buffer + kb * blockRow + b * MATRIX_BLOCK;
+                            minPlusBlock(rowBlock, pivot, rowBlock, stride);
+                        }
+                        else
+                        {
+                            float *columnBlock = buffer + b * blockRow + kb * MATRIX_BLOCK;
+                            minPlusBlock(columnBlock, columnBlock, pivot, stride);
+                        } });
+
+        // Fase 3: demais blocos
+        parallelFor(blocks * blocks, numThreads, [&](int task, int /*thread*/)
+                    {
+                        int ib = task / blocks;
+                        int jb = task % blocks;
+                        if (ib == kb || jb == kb)
+                            return;
+                        minPlusBlock(buffer + ib * blockRow + jb * MATRIX_BLOCK,
+                                     buffer + ib * blockRow + kb * MATRIX_BLOCK,
+                                     buffer + kb * blockRow + jb * MATRIX_BLOCK, stride); });
+    }
+}
@@ -0,0 +1,19 @@
+/*
+ * matrix.h
+ *
+ * Matriz de distâncias contígua e alinhada, com kernels min-plus em blocos
+ */
+
+#ifndef MATRIX_H
+#define MATRIX_H
+
+// Lado dos blocos (tiles) em que a matriz é particionada; múltiplo da largura SIMD
+#define MATRIX_BLOCK 64
+
+float **allocMatrix(int size, int *stride);
+void freeMatrix(float **matrix);
+void minPlusBlock(float *target, const float *left, const float *right, int stride);
+void minPlusMultiply(float *target, const float *left, const float *right, int size, int stride, int numThreads);
+void floydWarshallBlocked(float **matrix, int size, int stride, int numThreads);
+
+#endif /* ifndef MATRIX_H */
@@ -88,3 +88,48 @@ CARDINAL xrandom_exclude (CARDINAL excluded, CARDINAL limit)
 
   return rand;
 }
+
+/***********************************************************************************
+ * Funcao    : void xrandomize_stream (PRANDOM_STREAM stream, CARDINAL seed,       *
+ *                                     ULONG index)                                *
+ * Descricao : Inicializa um fluxo de numeros aleatorios a partir da semente e  do *
+ *             indice do fluxo. Fluxos de indices diferentes sao  independentes  e *
+ *             a sequencia de cada um depende apenas de (seed, index), nao da ordem *
+ *             em que as threads os utilizam.                                      *
+ * Parametros: stream  - fluxo a ser inicializado.                                 *
+ *             seed    - semente de randomizacao.                                  *
+ *             index   - indice do fluxo (por exemplo, o numero da iteracao).      *
+ * Retorno   : Nenhum                                                              *
+ ***********************************************************************************/
+
+void xrandomize_stream (PRANDOM_STREAM stream, CARDINAL seed, ULONG index)
+{
+  unsigned long long z;
+
+  z = ((unsigned long long) seed << 32) ^ (unsigned long long) index;
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+  stream->state = z ^ (z >> 31) ^ ((unsigned long long) seed >> 32);
+}
+
+/***********************************************************************************
+ * Funcao    : ULONG xrandom_stream (PRANDOM_STREAM stream, ULONG limit)           *
+ * Descricao : Gera um numero aleatorio entre 0 e limit - 1, inclusive, avancando  *
+ *             o fluxo (gerador splitmix64).                                       *
+ * Parametros: stream  - fluxo de numeros aleatorios.                              *
+ *             limit   - limite superior do numero aleatorio gerado, exclusive.    *
+ * Retorno   : Retorna o numero aleatorio gerado.                                  *
+ ***********************************************************************************/
+
+ULONG xrandom_stream (PRANDOM_STREAM stream, ULONG limit)
+{
+  unsigned long long z;
+
+  stream->state += 0x9E3779B97F4A7C15ULL;
+  z = stream->state;
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+  z = z ^ (z >> 31);
+
+  return (limit > 0) ? (ULONG) (z % limit) : 0;
+}
@@ -11,9 +11,18 @@
 
 #include "types.h"
 
+// Fluxo independente de numeros aleatorios, para uso concorrente entre threads
+typedef struct
+{
+  unsigned long long state;
+} RANDOM_STREAM, *PRANDOM_STREAM;
+
 void     xrandomize      (CARDINAL seed = 0);
 ULONG    xrandom         (ULONG limit);
 CARDINAL xrandom_range   (CARDINAL min, CARDINAL max);
 CARDINAL xrandom_exclude (CARDINAL excluded, CARDINAL limit);
 
+void     xrandomize_stream (PRANDOM_STREAM stream, CARDINAL seed, ULONG index);
+ULONG    xrandom_stream    (PRANDOM_STREAM stream, ULONG limit);
+
 #endif
@@ -0,0 +1,194 @@
+/*
+ * parallel.cpp
+ *
+ * Distribuição de tarefas independentes entre threads de um conjunto persistente
+ */
+
+#include "parallel.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+/****************
+ * Funcao    : int availableThreads()                                   *
+ * Descricao : Consulta a quantidade de núcleos disponíveis na máquina   *
+ * Parametros: Sem parâmetros.                                          *
+ * Retorno   : Quantidade de threads de hardware (ao menos 1).          *
+ ***************/
+int availableThreads()
+{
+    unsigned int hardware = thread::hardware_concurrency();
+    return hardware > 0 ? (int)hardware : 1;
+}
+
+/****************
+ * Funcao    : int resolveThreads(int numThreads)                                       *
+ * Descricao : Interpreta a quantidade de threads pedida; valores <= 0 usam todos os     *
+ *             núcleos disponíveis                                                      *
+ * Parametros: numThreads - quantidade de threads solicitada                            *
+ * Retorno   : Quantidade efetiva de threads.                                           *
+ ***************/
+int resolveThreads(int numThreads)
+{
+    return numThreads > 0 ? numThreads : availableThreads();
+}
+
+// Conjunto persistente de threads de trabalho, compartilhado por todas as chamadas de parallelFor. As
+// threads são criadas sob demanda (até a maior quantidade já pedida), esperam por trabalho em uma
+// variável de condição e só são encerradas no fim do programa.
+class WorkerPool
+{
+    // Atributos
+private:
+    vector<thread> workers;
+    mutex poolMutex;
+    mutex callMutex;
+    condition_variable workReady;
+    condition_variable workDone;
+    unsigned long generation;
+    bool stopping;
+    const function<void(int task, int thread)> *body;
+    int numTasks;
+    int numActive;
+    int numPending;
+    atomic<int> nextTask;
+
+public:
+    // Construtor
+    WorkerPool()
+    {
+        this->generation = 0;
+        this->stopping = false;
+        this->body = nullptr;
+        this->numTasks = this->numActive = this->numPending = 0;
+        this->nextTask = 0;
+    }
+
+    // Destrutor
+    ~WorkerPool()
+    {
+        {
+            lock_guard<mutex> lock(this->poolMutex);
+            this->stopping = true;
+        }
+        this->workReady.notify_all();
+        for (auto &&w : this->workers)
+            w.join();
+    }
+
+    // Métodos de manipulação
+    void reserve(int numThreads);
+    void run(int numTasks, int numThreads, const function<void(int task, int thread)> &body);
+
+private:
+    // Métodos auxiliares
+    void workerLoop(int threadIndex);
+};
+
+// A thread que executa uma tarefa de parallelFor não aguarda o conjunto: chamadas aninhadas são sequenciais
+static thread_local bool insideParallelFor = false;
+
+static WorkerPool workerPool;
+
+// Cria threads até que o conjunto tenha numThreads - 1 delas (a thread chamadora é a de índice 0)
+void WorkerPool::reserve(int numThreads)
+{
+    lock_guard<mutex> lock(this->poolMutex);
+    while ((int)this->workers.size() < numThreads - 1)
+        this->workers.emplace_back(&WorkerPool::workerLoop, this, (int)this->workers.size() + 1);
+}
+
+// Publica as tarefas para as threads 1 a numThreads-1, participa como thread 0 e espera as demais
+void WorkerPool::run(int numTasks, int numThreads, const function<void(int task, int thread)> &body)
+{
+    lock_guard<mutex> call(this->callMutex);
+    this->reserve(numThreads);
+    {
+        lock_guard<mutex> lock(this->poolMutex);
+        this->body = &body;
+        this->numTasks = numTasks;
+        this->numActive = numThreads - 1;
+        this->numPending = numThreads - 1;
+        this->nextTask = 0;
+        this->generation++;
+    }
+    this->workReady.notify_all();
+
+    insideParallelFor = true;
+    for (int task = this->nextTask++; task < numTasks; task = this->nextTask++)
+        body(task, 0);
+    insideParallelFor = false;
+
+    unique_lock<mutex> lock(this->poolMutex);
+    this->workDone.wait(lock, [this]
+                        { return this->numPending == 0; });
+    this->body = nullptr;
+}
+
+// Laço de uma thread do conjunto: a cada nova geração de trabalho, participa se o seu índice foi pedido
+void WorkerPool::workerLoop(int threadIndex)
+{
+    insideParallelFor = true;
+    unsigned long seen = 0;
+    unique_lock<mutex> lock(this->poolMutex);
+    while (true)
+    {
+        this->workReady.wait(lock, [this, seen]
+                             { return this->stopping || this->generation != seen; });
+        if (this->stopping)
+            return;
+        seen = this->generation;
+        if (threadIndex > this->numActive)
+            continue;
+
+        const function<void(int task, int thread)> *body = this->body;
+        int numTasks = this->numTasks;
+        lock.unlock();
+        for (int task = this->nextTask++; task < numTasks; task = this->nextTask++)
+            (*body)(task, threadIndex);
+        lock.lock();
+        if (--this->numPending == 0)
+            this->workDone.notify_one();
+    }
+}
+
+/****************
+ * Funcao    : void reserveThreads(int numThreads)                                                *
+ * Descricao : Cria antecipadamente as threads do conjunto persistente usado por parallelFor, para *
+ *             que a primeira chamada paralela de uma execução não pague a criação                 *
+ * Parametros: numThreads - quantidade de threads que as chamadas seguintes vão usar               *
+ * Retorno   : Sem retorno.                                                                       *
+ ***************/
+void reserveThreads(int numThreads)
+{
+    if (numThreads > 1 && !insideParallelFor)
+        workerPool.reserve(numThreads);
+}
+
+/****************
+ * Funcao    : void parallelFor(int numTasks, int numThreads, const function<void(int task, int thread)> &body) *
+ * Descricao : Executa body para cada tarefa em [0, numTasks), distribuindo as tarefas dinamicamente entre     *
+ *             numThreads threads do conjunto persistente, sem criar threads a cada chamada. Com uma única   *
+ *             thread, uma única tarefa ou dentro de outra chamada executa na thread chamadora.              *
+ * Parametros: numTasks - quantidade de tarefas                                                               *
+ *             numThreads - quantidade de threads a utilizar                                                  *
+ *             body - função que recebe o índice da tarefa e o índice (0 a numThreads-1) da thread executora  *
+ * Retorno   : Sem retorno.                                                                                   *
+ ***************/
+void parallelFor(int numTasks, int numThreads, const function<void(int task, int thread)> &body)
+{
+    if (numThreads > numTasks)
+        numThreads = numTasks;
+    if (numThreads <= 1 || insideParallelFor)
+    {
+        for (int task = 0; task < numTasks; task++)
+            body(task, 0);
+        return;
+    }
+    workerPool.run(numTasks, numThreads, body);
+}
@@ -0,0 +1,19 @@
+/*
+ * parallel.h
+ *
+ * Distribuição de tarefas independentes entre threads de um conjunto persistente
+ */
+
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+#include <functional>
+
+using namespace std;
+
+int availableThreads();
+int resolveThreads(int numThreads);
+void reserveThreads(int numThreads);
+void parallelFor(int numTasks, int numThreads, const function<void(int task, int thread)> &body);
+
+#endif /* ifndef PARALLEL_H */